@@ -2,6 +2,7 @@
 #include "conf/Fe_VER.h" // contains FORGE_BUILD_ID
 
 #include "RAPIER/Scene/SceneSerializer.h"
+#include "RAPIER/Asset/AssetManager.h"
 #include "RAPIER/Utilities/PlatformUtils.h"
 #include "RAPIER/Math/Math.h"
 
@@ -34,15 +35,15 @@ namespace RAPIER
 	{
 		RP_PROFILE_FUNC();
 
-		m_IconPlay = Texture2D::Create("Resources/Icons/PlayButton.png");
-		m_IconPause = Texture2D::Create("Resources/Icons/PauseButton.png");
-		m_IconStop = Texture2D::Create("Resources/Icons/StopButton.png");
+		m_IconPlay = AssetManager::GetTexture("Resources/Icons/PlayButton.png");
+		m_IconPause = AssetManager::GetTexture("Resources/Icons/PauseButton.png");
+		m_IconStop = AssetManager::GetTexture("Resources/Icons/StopButton.png");
 
-		m_IconMinimize = Texture2D::Create("Resources/Icons/MinimizeButton.png");
-		m_IconMaximize = Texture2D::Create("Resources/Icons/MaximizeButton.png");
-		m_IconClose = Texture2D::Create("Resources/Icons/CloseButton.png");
+		m_IconMinimize = AssetManager::GetTexture("Resources/Icons/MinimizeButton.png");
+		m_IconMaximize = AssetManager::GetTexture("Resources/Icons/MaximizeButton.png");
+		m_IconClose = AssetManager::GetTexture("Resources/Icons/CloseButton.png");
 
-		m_CheckerboardTexture = Texture2D::Create("assets/textures/Checkerboard.png");
+		m_CheckerboardTexture = AssetManager::GetTexture("assets/textures/Checkerboard.png");
 
 		FramebufferSpecification fbSpec;
 		fbSpec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RED_INTEGER, FramebufferTextureFormat::Depth };
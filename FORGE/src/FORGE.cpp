@@ -18,6 +18,7 @@
 #include <RAPIER/Core/Entry.h>	//	Entry Point
 
 #include "EditorLayer.h"
+#include "RAPIER/Debug/Benchmarks.h"
 
 #include <string>
 
@@ -32,6 +33,17 @@ namespace RAPIER
 			: Application(specification, args)
 		{
 			RP_INFO("RAPIER FORGE {}", FORGE_BUILD_ID);
+
+			//	FORGE --benchmark runs the engine benchmarks, logs the results and exits
+			if (args.Count > 1 && std::string(args[1]) == "--benchmark")
+			{
+				Benchmarks::RefCountChurn();
+				Benchmarks::AudioMixing();
+				Benchmarks::OfflineAudioRender();
+				Close();
+				return;
+			}
+
 			PushLayer(new EditorLayer());
 		}
 
@@ -1,6 +1,8 @@
 #include "rppch.h"
 #include "ContentBrowserPanel.h"
 
+#include "RAPIER/Asset/AssetManager.h"
+
 namespace RAPIER
 {
 	//	Change once we have projects
@@ -8,8 +10,8 @@ namespace RAPIER
 
 	ContentBrowserPanel::ContentBrowserPanel()
 	{
-		m_DirectoryIcon = Texture2D::Create("Resources/Icons/ContentBrowser/DirectoryIcon.png");
-		m_FileIcon = Texture2D::Create("Resources/Icons/ContentBrowser/FileIcon.png");
+		m_DirectoryIcon = AssetManager::GetTexture("Resources/Icons/ContentBrowser/DirectoryIcon.png");
+		m_FileIcon = AssetManager::GetTexture("Resources/Icons/ContentBrowser/FileIcon.png");
 
 		m_Columns.push_back(FileColumn(g_AssetPath, m_Columns.size()));
 	}
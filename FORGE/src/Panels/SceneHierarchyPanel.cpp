@@ -4,6 +4,7 @@
 #include <imgui/imgui_internal.h>
 
 #include "RAPIER/Scene/Components.h"
+#include "RAPIER/Asset/AssetManager.h"
 #include <cstring>
 
 
@@ -325,6 +326,14 @@ namespace RAPIER
 					ImGui::CloseCurrentPopup();
 				}
 			}
+			if (!m_SelectionContext.HasComponent<ParticleEmitterComponent>())
+			{
+				if (ImGui::Button("Particle Emitter"))
+				{
+					m_SelectionContext.AddComponent<ParticleEmitterComponent>();
+					ImGui::CloseCurrentPopup();
+				}
+			}
 			if (!m_SelectionContext.HasComponent<RigidBody2DComponent>())
 			{
 				if (ImGui::Button("Rigidbody 2D"))
@@ -455,7 +464,7 @@ namespace RAPIER
 				{
 					const wchar_t* path = (const wchar_t*)payload->Data;
 					std::filesystem::path texturePath = std::filesystem::path(g_AssetPath) / path;
-					Ref<Texture2D> texture = Texture2D::Create(texturePath.string());
+					Ref<Texture2D> texture = AssetManager::GetTexture(texturePath.string());
 					if (texture->IsLoaded())
 						component.Texture = texture;
 					else
@@ -474,6 +483,26 @@ namespace RAPIER
 				ImGui::DragFloat("Thickness", &component.Thickness, 0.025f, 0.0f, 1.0f);
 				ImGui::DragFloat("Fade", &component.Fade, 0.00025f, 0.0f, 1.0f);
 			});
+		//  -----------------------------  PARTICLE EMITTER COMPONENT  -----------------------------  //
+		DrawComponent<ParticleEmitterComponent>("Particle Emitter", entity, treeNodeFlags, [](auto& component)
+		{
+			auto& props = component.Props;
+			int maxParticles = (int)props.MaxParticles;
+			if (ImGui::DragInt("Max Particles", &maxParticles, 100.0f, 1, 2000000))
+				props.MaxParticles = (uint32_t)std::max(maxParticles, 1);
+			ImGui::DragFloat("Emission Rate", &props.EmissionRate, 10.0f, 0.0f, 1000000.0f);
+			ImGui::Checkbox("Emitting", &props.Emitting);
+			ImGui::DragFloat("Life Time", &props.LifeTime, 0.01f, 0.01f, 100.0f);
+			ImGui::DragFloat2("Velocity", glm::value_ptr(props.Velocity), 0.1f);
+			ImGui::DragFloat2("Velocity Variation", glm::value_ptr(props.VelocityVariation), 0.1f, 0.0f);
+			ImGui::DragFloat2("Acceleration", glm::value_ptr(props.Acceleration), 0.1f);
+			ImGui::DragFloat("Rotation Speed", &props.RotationSpeed, 0.01f);
+			ImGui::ColorEdit4("Color Begin", glm::value_ptr(props.ColorBegin));
+			ImGui::ColorEdit4("Color End", glm::value_ptr(props.ColorEnd));
+			ImGui::DragFloat("Size Begin", &props.SizeBegin, 0.01f, 0.0f);
+			ImGui::DragFloat("Size End", &props.SizeEnd, 0.01f, 0.0f);
+			ImGui::DragFloat("Size Variation", &props.SizeVariation, 0.01f, 0.0f);
+		});
 		//  -----------------------------  RIGID 2D BODY COMPONENT  -----------------------------  //
 		DrawComponent<RigidBody2DComponent>("Rigidbody 2D", entity, treeNodeFlags, [](auto& component)
 		{
@@ -508,6 +537,7 @@ namespace RAPIER
 			ImGui::DragFloat("Friction",              &component.Friction,    0.01f, 0.0f, 1.0f);
 			ImGui::DragFloat("Restitution",           &component.Restitution, 0.01f, 0.0f, 1.0f);
 			ImGui::DragFloat("Restitution Threshold", &component.RestitutionThreshold, 0.01f, 0.0f);
+			ImGui::Checkbox("Is Trigger", &component.IsTrigger);
 		});
 		//  -----------------------------  CIRCLE COLLIDER COMPONENT  -----------------------------  //
 		DrawComponent<CircleCollider2DComponent>("Circle Collider 2D", entity, treeNodeFlags, [](auto& component)
@@ -518,6 +548,7 @@ namespace RAPIER
 			ImGui::DragFloat("Friction",    &component.Friction, 0.01f, 0.0f, 1.0f);
 			ImGui::DragFloat("Restitution", &component.Restitution, 0.01f, 0.0f, 1.0f);
 			ImGui::DragFloat("Restitution Threshold", &component.RestitutionThreshold, 0.01f, 0.0f);
+			ImGui::Checkbox("Is Trigger", &component.IsTrigger);
 		});
 
 	}	//	END DrawComponents
@@ -2,6 +2,7 @@
 
 #include "RAPIER/Utilities/FileSystem.h"
 #include "RAPIER/Renderer/Texture.h"
+#include "RAPIER/Asset/AssetManager.h"
 
 #include "RAPIER/ImGui/ImGui.h"
 #include "RAPIER/Utilities/StringUtils.h"
@@ -44,7 +45,7 @@ namespace RAPIER
 
 	void IgnitionLayer::OnAttach()
 	{
-		m_RapierLogo = Texture2D::Create("Resources/Editor/RAPIER.png");
+		m_RapierLogo = AssetManager::GetTexture("Resources/Editor/RAPIER.png");
 	}
 
 	void IgnitionLayer::OnDetach()
@@ -8,6 +8,11 @@ namespace RAPIER
 	{
 		public ulong ID { get; private set; }
 
+		public event Action<Entity> Collision2DBeginEvent;
+		public event Action<Entity> Collision2DEndEvent;
+		public event Action<Entity> TriggerBeginEvent;
+		public event Action<Entity> TriggerEndEvent;
+
 		internal Entity(ulong id)
 		{
 			ID = id;
@@ -64,6 +69,27 @@ namespace RAPIER
 			return new Entity(CreateEntity_Native(ID));
 		}
 
+		//	Called by the engine once per entity pair after the physics step
+		private void OnCollision2DBegin(ulong id)
+		{
+			Collision2DBeginEvent?.Invoke(new Entity(id));
+		}
+
+		private void OnCollision2DEnd(ulong id)
+		{
+			Collision2DEndEvent?.Invoke(new Entity(id));
+		}
+
+		private void OnTriggerBegin(ulong id)
+		{
+			TriggerBeginEvent?.Invoke(new Entity(id));
+		}
+
+		private void OnTriggerEnd(ulong id)
+		{
+			TriggerEndEvent?.Invoke(new Entity(id));
+		}
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void CreateComponent_Native(ulong entityID, Type type);
 		[MethodImpl(MethodImplOptions.InternalCall)]
@@ -0,0 +1,20 @@
+﻿using System.Runtime.InteropServices;
+
+namespace RAPIER
+{
+	//	Same layout as the engine's TransformComponent, rotation is euler angles in radians
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Transform
+	{
+		public Vector3 Translation;
+		public Vector3 Rotation;
+		public Vector3 Scale;
+
+		public Transform(Vector3 translation, Vector3 rotation, Vector3 scale)
+		{
+			Translation = translation;
+			Rotation = rotation;
+			Scale = scale;
+		}
+	}
+}	//	END namespace RAPIER
@@ -0,0 +1,34 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace RAPIER
+{
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Vector2
+	{
+		public float X;
+		public float Y;
+
+		public static readonly Vector2 Zero = new Vector2(0.0f, 0.0f);
+
+		public Vector2(float scalar)
+		{
+			X = Y = scalar;
+		}
+
+		public Vector2(float x, float y)
+		{
+			X = x;
+			Y = y;
+		}
+
+		public float Length() => (float)Math.Sqrt(X * X + Y * Y);
+
+		public static Vector2 operator +(Vector2 left, Vector2 right) => new Vector2(left.X + right.X, left.Y + right.Y);
+		public static Vector2 operator -(Vector2 left, Vector2 right) => new Vector2(left.X - right.X, left.Y - right.Y);
+		public static Vector2 operator *(Vector2 left, float scalar) => new Vector2(left.X * scalar, left.Y * scalar);
+		public static Vector2 operator -(Vector2 vector) => new Vector2(-vector.X, -vector.Y);
+
+		public override string ToString() => $"Vector2[{X}, {Y}]";
+	}
+}	//	END namespace RAPIER
@@ -0,0 +1,49 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace RAPIER
+{
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Vector3
+	{
+		public float X;
+		public float Y;
+		public float Z;
+
+		public static readonly Vector3 Zero = new Vector3(0.0f, 0.0f, 0.0f);
+
+		public Vector3(float scalar)
+		{
+			X = Y = Z = scalar;
+		}
+
+		public Vector3(float x, float y, float z)
+		{
+			X = x;
+			Y = y;
+			Z = z;
+		}
+
+		public Vector3(Vector2 xy, float z)
+		{
+			X = xy.X;
+			Y = xy.Y;
+			Z = z;
+		}
+
+		public Vector2 XY
+		{
+			get => new Vector2(X, Y);
+			set { X = value.X; Y = value.Y; }
+		}
+
+		public float Length() => (float)Math.Sqrt(X * X + Y * Y + Z * Z);
+
+		public static Vector3 operator +(Vector3 left, Vector3 right) => new Vector3(left.X + right.X, left.Y + right.Y, left.Z + right.Z);
+		public static Vector3 operator -(Vector3 left, Vector3 right) => new Vector3(left.X - right.X, left.Y - right.Y, left.Z - right.Z);
+		public static Vector3 operator *(Vector3 left, float scalar) => new Vector3(left.X * scalar, left.Y * scalar, left.Z * scalar);
+		public static Vector3 operator -(Vector3 vector) => new Vector3(-vector.X, -vector.Y, -vector.Z);
+
+		public override string ToString() => $"Vector3[{X}, {Y}, {Z}]";
+	}
+}	//	END namespace RAPIER
@@ -0,0 +1,84 @@
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace RAPIER
+{
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Ray2D
+	{
+		public Vector2 Origin;
+		public Vector2 Direction;
+		public float MaxDistance;
+
+		public Ray2D(Vector2 origin, Vector2 direction, float maxDistance)
+		{
+			Origin = origin;
+			Direction = direction;
+			MaxDistance = maxDistance;
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct CircleCast2D
+	{
+		public Vector2 Origin;
+		public Vector2 Direction;
+		public float MaxDistance;
+		public float Radius;
+
+		public CircleCast2D(Vector2 origin, Vector2 direction, float maxDistance, float radius)
+		{
+			Origin = origin;
+			Direction = direction;
+			MaxDistance = maxDistance;
+			Radius = radius;
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct AABB2D
+	{
+		public Vector2 Min;
+		public Vector2 Max;
+
+		public AABB2D(Vector2 min, Vector2 max)
+		{
+			Min = min;
+			Max = max;
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Hit2D
+	{
+		public ulong EntityID;	//	0 if nothing was hit
+		public Vector2 Point;
+		public Vector2 Normal;
+		public float Distance;
+
+		public bool Hit => EntityID != 0;
+	}
+
+	//	Batched queries against the active scene's physics world. Triggers are never hit.
+	//	A whole batch costs one call into the engine and runs in parallel there, so fill the arrays once
+	//	for every agent rather than querying one at a time:
+	//
+	//		for (int i = 0; i < count; i++)
+	//			m_Rays[i] = new Ray2D(positions[i], target - positions[i], viewDistance);
+	//		Physics2D.Raycast(m_Rays, m_Hits, count);
+	public static class Physics2D
+	{
+		public static void Raycast(Ray2D[] rays, Hit2D[] hits, int count) => Raycast_Native(rays, hits, count);
+		public static void CircleCast(CircleCast2D[] casts, Hit2D[] hits, int count) => CircleCast_Native(casts, hits, count);
+
+		//	Box i writes its entities from ids[i * maxResultsPerBox], counts[i] may be larger than maxResultsPerBox
+		public static void OverlapAABB(AABB2D[] boxes, int count, int maxResultsPerBox, ulong[] ids, uint[] counts) => OverlapAABB_Native(boxes, count, maxResultsPerBox, ids, counts);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Raycast_Native(Ray2D[] inRays, Hit2D[] outHits, int count);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void CircleCast_Native(CircleCast2D[] inCasts, Hit2D[] outHits, int count);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void OverlapAABB_Native(AABB2D[] inBoxes, int count, int maxResultsPerBox, ulong[] outIDs, uint[] outCounts);
+	}
+}	//	END namespace RAPIER
@@ -40,6 +40,7 @@ namespace RAPIER
 			get
 			{
 				GetTransform_Native(Entity.ID, out Transform result);
+				return result;
 			}
 			set
 			{
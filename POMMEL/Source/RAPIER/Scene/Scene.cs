@@ -0,0 +1,75 @@
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace RAPIER
+{
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RigidBody2DVelocity
+	{
+		public Vector2 Linear;
+		public float Angular;
+	}
+
+	//	Bulk access to the active scene. Keep the arrays around between frames, nothing here allocates.
+	//	Getters fill as much as fits and return the total count, grow the arrays and call again if it's larger:
+	//
+	//		int count = Scene.GetTransforms(ref m_IDs, ref m_Transforms);
+	//		for (int i = 0; i < count; i++)
+	//			m_Transforms[i].Translation.Y += 1.0f;
+	//		Scene.SetTransforms(m_IDs, m_Transforms, count);
+	public static class Scene
+	{
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		public static extern Entity[] GetEntities();
+
+		public static int GetEntityIDs(ref ulong[] ids)
+		{
+			int count = GetEntityIDs_Native(ids);
+			if (ids == null || count > ids.Length)
+			{
+				ids = new ulong[count];
+				count = GetEntityIDs_Native(ids);
+			}
+			return count;
+		}
+
+		public static int GetTransforms(ref ulong[] ids, ref Transform[] transforms)
+		{
+			int count = GetTransforms_Native(ids, transforms);
+			if (ids == null || transforms == null || count > ids.Length || count > transforms.Length)
+			{
+				ids = new ulong[count];
+				transforms = new Transform[count];
+				count = GetTransforms_Native(ids, transforms);
+			}
+			return count;
+		}
+
+		public static void SetTransforms(ulong[] ids, Transform[] transforms, int count) => SetTransforms_Native(ids, transforms, count);
+
+		public static int GetRigidBody2DVelocities(ref ulong[] ids, ref RigidBody2DVelocity[] velocities)
+		{
+			int count = GetRigidBody2DVelocities_Native(ids, velocities);
+			if (ids == null || velocities == null || count > ids.Length || count > velocities.Length)
+			{
+				ids = new ulong[count];
+				velocities = new RigidBody2DVelocity[count];
+				count = GetRigidBody2DVelocities_Native(ids, velocities);
+			}
+			return count;
+		}
+
+		public static void SetRigidBody2DVelocities(ulong[] ids, RigidBody2DVelocity[] velocities, int count) => SetRigidBody2DVelocities_Native(ids, velocities, count);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int GetEntityIDs_Native(ulong[] outIDs);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int GetTransforms_Native(ulong[] outIDs, Transform[] outTransforms);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void SetTransforms_Native(ulong[] inIDs, Transform[] inTransforms, int count);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int GetRigidBody2DVelocities_Native(ulong[] outIDs, RigidBody2DVelocity[] outVelocities);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void SetRigidBody2DVelocities_Native(ulong[] inIDs, RigidBody2DVelocity[] inVelocities, int count);
+	}
+}	//	END namespace RAPIER
@@ -21,12 +21,14 @@
 #include "RAPIER/Core/Layer.h"				//	Class for managing layers
 #include "RAPIER/Core/Timestep.h"			//	Allows updates based on real time instead of frame time
 #include "RAPIER/Core/Timer.h"				//	Definition for timer
+#include "RAPIER/Core/Random.h"				//	Thread local random number generation
 
 //  --------------  Event headers  --------------  //
 #include "RAPIER/Core/Events/Event.h"
 #include "RAPIER/Core/Events/ApplicationEvent.h"
 #include "RAPIER/Core/Events/KeyEvent.h"
 #include "RAPIER/Core/Events/MouseEvent.h"
+#include "RAPIER/Core/Events/EventQueue.h"
 
 //  --------------  Input headers  --------------  //
 #include "RAPIER/Core/Input.h"				//	Main input header file 
@@ -1,10 +1,12 @@
 #include "rppch.h"
 #include "AssetManager.h"
 
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 #include "RAPIER/Renderer/SceneRenderer.h"
 #include "RAPIER/Project/Project.h"
 
 #include <yaml-cpp/yaml.h>
+#include <imgui/imgui.h>
 
 #include <filesystem>
 
@@ -47,6 +49,8 @@ namespace RAPIER {
 
 	void AssetManager::Init()
 	{
+		RP_MEMORY_TAG(Assets);
+
 		FileSystem::SetChangeCallback(AssetManager::OnFileSystemChanged);
 		ReloadAssets();
 	}
@@ -59,6 +63,161 @@ namespace RAPIER {
 	void AssetManager::Shutdown()
 	{
 		s_LoadedAssets.clear();
+
+		std::scoped_lock<std::mutex> lock(s_TextureCacheMutex);
+		s_TextureCache.clear();
+		s_TextureCacheLRU.clear();
+		s_TextureCacheStats.ResidentBytes = 0;
+		s_TextureCacheStats.RetainedBytes = 0;
+		s_TextureCacheStats.ResidentCount = 0;
+	}
+
+	void AssetManager::OnImGuiRender(bool& open)
+	{
+		if (!open)
+			return;
+
+		ImGui::Begin("Asset Manager", &open);
+		TextureCacheStats stats = GetTextureCacheStats();
+		ImGui::Text("Textures: %u", stats.ResidentCount);
+		ImGui::Text("Resident: %.2f MB", (float)stats.ResidentBytes / (1024.0f * 1024.0f));
+		ImGui::Text("Retained: %.2f / %.2f MB", (float)stats.RetainedBytes / (1024.0f * 1024.0f), (float)stats.BudgetBytes / (1024.0f * 1024.0f));
+		ImGui::Text("Hit Rate: %.1f%% (%llu hits, %llu misses)", stats.GetHitRate() * 100.0f, stats.Hits, stats.Misses);
+		ImGui::Text("Evictions: %llu", stats.Evictions);
+		if (ImGui::Button("Collect Unused"))
+			CollectUnusedTextures();
+		ImGui::End();
+	}
+
+	//  -----------------------------  TEXTURE CACHE  -----------------------------  //
+	static std::string NormalizeTexturePath(const std::string& filepath)
+	{
+		return std::filesystem::path(filepath).lexically_normal().generic_string();
+	}
+
+	Ref<Texture2D> AssetManager::GetTexture(const std::string& filepath)
+	{
+		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Assets);
+
+		const std::string key = NormalizeTexturePath(filepath);
+
+		std::scoped_lock<std::mutex> lock(s_TextureCacheMutex);
+		auto it = s_TextureCache.find(key);
+		if (it != s_TextureCache.end())
+		{
+			TextureCacheEntry& entry = it->second;
+			Ref<Texture2D> texture = entry.Retained ? entry.Retained : entry.Weak.Lock();
+			if (texture)
+			{
+				s_TextureCacheStats.Hits++;
+				RetainTexture(key, entry, texture);
+				return texture;
+			}
+
+			//	Every reference was dropped since the last request
+			s_TextureCache.erase(it);
+		}
+
+		s_TextureCacheStats.Misses++;
+		Ref<Texture2D> texture = Texture2D::Create(key);
+		if (!texture->IsLoaded())
+			return texture;	//	Failed loads are not cached so the file can be fixed and reloaded
+
+		TextureCacheEntry& entry = s_TextureCache[key];
+		entry.Weak = texture;
+		entry.Size = texture->GetMemorySize();
+		RetainTexture(key, entry, texture);
+
+		return texture;
+	}
+
+	Ref<Texture2D> AssetManager::GetTexture(AssetHandle handle)
+	{
+		auto it = s_LoadedAssets.find(handle);
+		if (it == s_LoadedAssets.end())
+		{
+			RP_CORE_WARN("AssetManager::GetTexture - Unknown asset handle {0}", handle);
+			return nullptr;
+		}
+
+		RP_CORE_ASSERT(it->second->Type == AssetType::Texture, "Asset is not a texture!");
+		return GetTexture(it->second->FilePath);
+	}
+
+	void AssetManager::SetTextureCacheBudget(uint64_t bytes)
+	{
+		std::scoped_lock<std::mutex> lock(s_TextureCacheMutex);
+		s_TextureCacheStats.BudgetBytes = bytes;
+		EvictTextures(bytes);
+	}
+
+	void AssetManager::CollectUnusedTextures()
+	{
+		std::scoped_lock<std::mutex> lock(s_TextureCacheMutex);
+		EvictTextures(0);
+		PruneTextureCache();
+	}
+
+	TextureCacheStats AssetManager::GetTextureCacheStats()
+	{
+		std::scoped_lock<std::mutex> lock(s_TextureCacheMutex);
+		PruneTextureCache();
+		return s_TextureCacheStats;
+	}
+
+	//	The functions below expect s_TextureCacheMutex to be held
+	void AssetManager::RetainTexture(const std::string& key, TextureCacheEntry& entry, const Ref<Texture2D>& texture)
+	{
+		if (entry.Retained)
+		{
+			s_TextureCacheLRU.splice(s_TextureCacheLRU.begin(), s_TextureCacheLRU, entry.LRUPosition);
+			return;
+		}
+
+		entry.Retained = texture;
+		s_TextureCacheLRU.push_front(key);
+		entry.LRUPosition = s_TextureCacheLRU.begin();
+		s_TextureCacheStats.RetainedBytes += entry.Size;
+
+		if (s_TextureCacheStats.RetainedBytes > s_TextureCacheStats.BudgetBytes)
+			EvictTextures(s_TextureCacheStats.BudgetBytes);
+	}
+
+	//	Releases the cache's strong references, least recently used first. Textures still used
+	//	elsewhere stay alive and are found again through the weak reference.
+	void AssetManager::EvictTextures(uint64_t targetBytes)
+	{
+		while (!s_TextureCacheLRU.empty() && s_TextureCacheStats.RetainedBytes > targetBytes)
+		{
+			auto entryIt = s_TextureCache.find(s_TextureCacheLRU.back());
+			RP_CORE_ASSERT(entryIt != s_TextureCache.end());
+
+			TextureCacheEntry& entry = entryIt->second;
+			s_TextureCacheStats.RetainedBytes -= entry.Size;
+			s_TextureCacheStats.Evictions++;
+			entry.Retained = nullptr;
+			s_TextureCacheLRU.pop_back();
+		}
+	}
+
+	void AssetManager::PruneTextureCache()
+	{
+		s_TextureCacheStats.ResidentBytes = 0;
+		s_TextureCacheStats.ResidentCount = 0;
+
+		for (auto it = s_TextureCache.begin(); it != s_TextureCache.end();)
+		{
+			if (!it->second.Retained && !it->second.Weak.IsValid())
+			{
+				it = s_TextureCache.erase(it);
+				continue;
+			}
+
+			s_TextureCacheStats.ResidentBytes += it->second.Size;
+			s_TextureCacheStats.ResidentCount++;
+			++it;
+		}
 	}
 
 	void AssetManager::OnFileSystemChanged(const std::vector<FileSystemChangedEvent>& events)
@@ -125,4 +284,9 @@ namespace RAPIER {
 	std::unordered_map<AssetHandle, Ref<Asset>> AssetManager::s_LoadedAssets;
 	AssetManager::AssetsChangeEventFn AssetManager::s_AssetsChangeCallback;
 
+	std::unordered_map<std::string, AssetManager::TextureCacheEntry> AssetManager::s_TextureCache;
+	std::list<std::string> AssetManager::s_TextureCacheLRU;
+	TextureCacheStats AssetManager::s_TextureCacheStats = { 0, 0, 0, 0, 0, 256ull * 1024 * 1024, 0 };
+	std::mutex AssetManager::s_TextureCacheMutex;
+
 }
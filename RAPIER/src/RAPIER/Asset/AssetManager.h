@@ -4,10 +4,13 @@
 #include "RAPIER/Project/Project.h"
 #include "RAPIER/Utilities/FileSystem.h"
 #include "RAPIER/Utilities/StringUtils.h"
+#include "RAPIER/Renderer/Texture.h"
 
 #include "RAPIER/Debug/Profiler.h"
 
+#include <list>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 
 namespace RAPIER
@@ -30,6 +33,20 @@ namespace RAPIER
 		static std::map<std::string, AssetType> s_Types;
 	};
 
+	struct TextureCacheStats
+	{
+		uint64_t Hits = 0;
+		uint64_t Misses = 0;
+		uint64_t Evictions = 0;
+
+		uint64_t ResidentBytes = 0;	//	Every cached texture that is still alive
+		uint64_t RetainedBytes = 0;	//	Kept alive by the cache itself, bounded by BudgetBytes
+		uint64_t BudgetBytes = 0;
+		uint32_t ResidentCount = 0;
+
+		float GetHitRate() const { return (Hits + Misses) > 0 ? (float)Hits / (float)(Hits + Misses) : 0.0f; }
+	};
+
 	class AssetManager
 	{
 	public:
@@ -41,6 +58,16 @@ namespace RAPIER
 
 		static std::string StripExtras(const std::string& filename);
 		static void OnImGuiRender(bool& open);
+
+		//  -----------------------------  TEXTURE CACHE  -----------------------------  //
+		//	Identical paths share one GPU texture. The cache keeps recently used textures alive up to
+		//	the budget and only holds weak references to the rest, so it never pins evicted memory.
+		static Ref<Texture2D> GetTexture(const std::string& filepath);
+		static Ref<Texture2D> GetTexture(AssetHandle handle);
+
+		static void SetTextureCacheBudget(uint64_t bytes);
+		static void CollectUnusedTextures();	//	Releases every strong reference held by the cache
+		static TextureCacheStats GetTextureCacheStats();
 	private:
 		static void LoadAssetRegistry();
 		static void ProcessDirectory(const std::filesystem::path& directoryPath);
@@ -54,10 +81,27 @@ namespace RAPIER
 		static void OnAssetMoved(AssetHandle assetHandle, const std::filesystem::path& destinationPath);
 		static void OnAssetDeleted(AssetHandle assetHandle);
 
+		struct TextureCacheEntry;
+		static void RetainTexture(const std::string& key, TextureCacheEntry& entry, const Ref<Texture2D>& texture);
+		static void EvictTextures(uint64_t targetBytes);
+		static void PruneTextureCache();
+
 	private:
 		static std::unordered_map<AssetHandle, Ref<Asset>> s_LoadedAssets;
 		static std::unordered_map<AssetHandle, Ref<Asset>> s_MemoryAssets;
 		static AssetsChangeEventFn s_AssetsChangeCallback;
+
+		struct TextureCacheEntry
+		{
+			WeakRef<Texture2D> Weak;
+			Ref<Texture2D> Retained;	//	Null once evicted from the LRU
+			uint64_t Size = 0;
+			std::list<std::string>::iterator LRUPosition;
+		};
+		static std::unordered_map<std::string, TextureCacheEntry> s_TextureCache;
+		static std::list<std::string> s_TextureCacheLRU;	//	Front is most recently used
+		static TextureCacheStats s_TextureCacheStats;
+		static std::mutex s_TextureCacheMutex;
 		//inline static AssetRegistry s_AssetRegistry;
 
 	private:
@@ -2,9 +2,9 @@
 #include "Audio.h"
 
 #include "RAPIER/Debug/Profiler.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 
 #include <chrono>
-using namespace std::chrono_literals;
 
 namespace RAPIER::Audio
 {
@@ -12,9 +12,11 @@ namespace RAPIER::Audio
 	std::atomic<bool> AudioThread::s_ThreadActive = false;
 	std::atomic<std::thread::id> AudioThread::s_AudioThreadID = std::thread::id();
 
-	std::queue<AudioFunctionCallback*> AudioThread::s_AudioThreadJobs;
-	static std::queue<AudioFunctionCallback*> s_AudioThreadJobsLocal;
-	std::mutex AudioThread::s_AudioThreadJobsLock;
+	MPSCQueue<AudioFunctionCallback, AudioThread::MaxPendingJobs> AudioThread::s_AudioThreadJobs;
+
+	std::atomic<bool> AudioThread::s_Sleeping = false;
+	std::mutex AudioThread::s_WakeMutex;
+	std::condition_variable AudioThread::s_WakeCondition;
 
 	std::function<void(RAPIER::Timestep)> AudioThread::OnUpdateCallback = nullptr;
 	RAPIER::Timer AudioThread::s_Timer;
@@ -30,6 +32,7 @@ namespace RAPIER::Audio
 		s_AudioThread = new std::thread([]
 			{
 				RP_PROFILE_THREAD("AudioThread");
+				AllocationTracker::SetThreadTag(MemoryTag::Audio);
 
 				#if defined(RP_PLATFORM_WINDOWS)
 					HRESULT r;
@@ -59,6 +62,7 @@ namespace RAPIER::Audio
 			return false;
 
 		s_ThreadActive = false;
+		WakeUp();
 		return true;
 	}
 
@@ -77,59 +81,52 @@ namespace RAPIER::Audio
 		return s_AudioThreadID;
 	}
 
-	void AudioThread::AddTask(AudioFunctionCallback*&& funcCb)
+	void AudioThread::WakeUp()
 	{
-		RP_PROFILE_FUNC();
-
-		std::scoped_lock lock(s_AudioThreadJobsLock);
-		s_AudioThreadJobs.emplace(std::move(funcCb));
+		if (s_Sleeping.exchange(false))
+		{
+			std::scoped_lock lock(s_WakeMutex);
+			s_WakeCondition.notify_one();
+		}
 	}
 
 	void AudioThread::OnUpdate()
 	{
 		RP_PROFILE_FUNC();
 
-		s_Timer.Reset();
-
 		//---------------------------
 		//--- Handle AudioThread Jobs
 
 		{
 			RP_PROFILE_FUNC("AudioThread::OnUpdate - Execution");
 
-			auto& jobs = s_AudioThreadJobsLocal;
-			{
-				std::scoped_lock lock(s_AudioThreadJobsLock);
-				s_AudioThreadJobsLocal = s_AudioThreadJobs;
-				s_AudioThreadJobs = std::queue<AudioFunctionCallback*>();
-			}
-			if (!jobs.empty())
-			{
-				// Should not run while jobs are not complete, instead re-add them to run on the next update loop
-				for (int i = (int)jobs.size() - 1; i >= 0; i--)
-				{
-					auto job = jobs.front();
-					//HZ_CONSOLE_LOG_INFO("AudioThread. Executing: {}", job->GetID());
-					job->Execute();
-
-					// TODO: check if job ran successfully, if not, notify and/or add back to the queue
-					jobs.pop();
-					delete job; // TODO: replace with smart pointer :[
-				}
-			}
+			// TODO: check if job ran successfully, if not, notify and/or add back to the queue
+			while (s_AudioThreadJobs.TryPop([](AudioFunctionCallback& job) { job.Execute(); }));
 		}
 
-		RP_CORE_ASSERT(OnUpdateCallback != nullptr, "Update Function is not bound!");
-		OnUpdateCallback(s_Timestep);
-
+		//	Woken up early for a job, the update callback keeps its regular interval
+		if (s_Timer.Elapsed() >= std::chrono::duration<float>(UpdateInterval).count())
+		{
+			s_Timestep = s_Timer.Elapsed();
+			s_LastFrameTime = s_Timestep.GetMilliseconds();
+			s_Timer.Reset();
 
-		std::this_thread::sleep_for(1ms);
+			RP_CORE_ASSERT(OnUpdateCallback != nullptr, "Update Function is not bound!");
+			OnUpdateCallback(s_Timestep);
+		}
 
-		s_Timestep = s_Timer.Elapsed();
-		s_LastFrameTime = s_Timestep.GetMilliseconds();
+		//	Sleep until the next update or until a job is submitted
+		s_Sleeping = true;
+		if (s_AudioThreadJobs.IsEmpty() && s_ThreadActive)
+		{
+			const float remaining = std::chrono::duration<float>(UpdateInterval).count() - s_Timer.Elapsed();
+			if (remaining > 0.0f)
+			{
+				std::unique_lock lock(s_WakeMutex);
+				s_WakeCondition.wait_for(lock, std::chrono::duration<float>(remaining), [] { return !s_Sleeping.load(); });
+			}
+		}
+		s_Sleeping = false;
 	}
 
-
-
-
 }	//	END namespace RAPIER::Audio
@@ -2,10 +2,14 @@
 
 #include <thread>
 #include <atomic>
-#include <queue>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 
 #include "RAPIER/Core/Timer.h"
 #include "RAPIER/Core/Timestep.h"
+#include "RAPIER/Core/LockFreeQueue.h"
+#include "RAPIER/Audio/SimpleBufferOperations.h"
 
 namespace RAPIER
 {
@@ -18,23 +22,43 @@ namespace RAPIER::Audio
 	static constexpr auto STOPPING_FADE_MS = 28;
 	static constexpr float SPEED_OF_SOUND = 343.3f;
 
-	using AudioThreadCallbackFunction = std::function<void()>;
-
+	//	Type-erased job stored inline, the callable must fit in StorageSize bytes
 	class AudioFunctionCallback
 	{
 	public:
-		AudioFunctionCallback(AudioThreadCallbackFunction f, const char* jobID = "NONE")
-			: m_Func(std::move(f)), m_JobID(jobID)
-		{}
+		static constexpr size_t StorageSize = 64;
+
+		template<typename FuncT>
+		AudioFunctionCallback(FuncT&& func, const char* jobID = "NONE")
+			: m_JobID(jobID)
+		{
+			using Func = std::decay_t<FuncT>;
+			static_assert(sizeof(Func) <= StorageSize, "Audio job captures too much, capture a pointer to the data instead");
+			static_assert(alignof(Func) <= alignof(std::max_align_t), "Audio job alignment is not supported");
+
+			new (m_Storage) Func(std::forward<FuncT>(func));
+			m_Invoke = [](void* storage) { (*static_cast<Func*>(storage))(); };
+			m_Destroy = [](void* storage) { static_cast<Func*>(storage)->~Func(); };
+		}
+
+		~AudioFunctionCallback()
+		{
+			m_Destroy(m_Storage);
+		}
+
+		AudioFunctionCallback(const AudioFunctionCallback&) = delete;
+		AudioFunctionCallback& operator=(const AudioFunctionCallback&) = delete;
 
 		void Execute()
 		{
-			m_Func();
+			m_Invoke(m_Storage);
 		}
 
-		const char* GetID() { return m_JobID; }
+		const char* GetID() const { return m_JobID; }
 	private:
-		AudioThreadCallbackFunction const m_Func;
+		alignas(std::max_align_t) std::byte m_Storage[StorageSize];
+		void (*m_Invoke)(void*);
+		void (*m_Destroy)(void*);
 		const char* m_JobID;
 	};
 
@@ -50,28 +74,48 @@ namespace RAPIER::Audio
 	private:
 		friend class RAPIER::MiniAudioEngine;
 
-		static void AddTask(AudioFunctionCallback*&& funcCb);
+		//	Lock-free, callable from any thread. Wakes the audio thread if it is waiting.
+		template<typename FuncT>
+		static void AddTask(FuncT&& func, const char* jobID = "NONE")
+		{
+			RP_PROFILE_FUNC();
+
+			//	Only spins when MaxPendingJobs are queued, the job is not moved from on failure
+			while (!s_AudioThreadJobs.TryPush(std::forward<FuncT>(func), jobID))
+				std::this_thread::yield();
+
+			WakeUp();
+		}
+
+		static void WakeUp();
 		static void OnUpdate();
 		static float GetFrameTime() { return s_LastFrameTime.load(); }
 
 		template<typename C, void (C::* Function)(Timestep)>
 		static void BindUpdateFunction(C* instance)
 		{
-			OnUpdateCallback = [instance](Timestep ts) { (static_cast<C*>(instance)->*function)(ts); };
+			OnUpdateCallback = [instance](Timestep ts) { (static_cast<C*>(instance)->*Function)(ts); };
 		}
 
 		template<typename FuncT>
 		static void BindUpdateFunction(FuncT&& func)
 		{
-			OnUpdateCallback = [func](Timesstep ts) { func(ts); };
+			OnUpdateCallback = [func](Timestep ts) { func(ts); };
 		}
 	private:
+		static constexpr size_t MaxPendingJobs = 1024;
+		static constexpr auto UpdateInterval = std::chrono::milliseconds(1);
+
 		static std::thread* s_AudioThread;
 		static std::atomic<bool> s_ThreadActive;
 		static std::atomic<std::thread::id> s_AudioThreadID;
 
-		static std::queue<AudioFunctionCallback*> s_AudioThreadJobs;
-		static std::mutex s_AudioThreadJobsLock;
+		static MPSCQueue<AudioFunctionCallback, MaxPendingJobs> s_AudioThreadJobs;
+
+		//	Only touched when the audio thread is about to wait, producers never lock otherwise
+		static std::atomic<bool> s_Sleeping;
+		static std::mutex s_WakeMutex;
+		static std::condition_variable s_WakeCondition;
 
 		static std::function<void(Timestep)> OnUpdateCallback;
 		static Timer s_Timer;
@@ -106,67 +150,4 @@ namespace RAPIER::Audio
 		return a + t * (b - a);
 	}
 
-	class SimpleBufferOperations
-	{
-	public:
-		static inline void ApplyGainRamp(float* data, uint32_t numSamples, uint32_t numChannels, float gainStart, float gainEnd)
-		{
-			const float delta = (gainEnd - gainStart) / (float)numSamples;
-			for (uint32_t i = 0; i < numSamples; ++i)
-			{
-				for (uint32_t ch = 0; ch < numChannels; ++ch)
-					data[i * numChannels + ch] *= gainStart + delta * i;
-			}
-		}
-
-		static inline void ApplyGainRampToSingleChannel(float* data, uint32_t numSamples, uint32_t numChannels, uint32_t channel, float gainStart, float gainEnd)
-		{
-			const float delta = (gainEnd - gainStart) / (float)numSamples;
-			for (uint32_t i = 0; i < numSamples; ++i)
-			{
-				data[i * numChannels + channel] *= gainStart + delta * i;
-			}
-		}
-
-		static inline void AddAndApplyGainRamp(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
-			uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gainStart, float gainEnd)
-		{
-			if (gainEnd == gainStart)
-			{
-				for (uint32_t i = 0; i < numSamples; ++i)
-					dest[i * destNumChannels + destChannel] += source[i * sourceNumChannels + sourceChannel] * gainStart;
-			}
-			else
-			{
-				const float delta = (gainEnd - gainStart) / (float)numSamples;
-				for (uint32_t i = 0; i < numSamples; ++i)
-				{
-					dest[i * destNumChannels + destChannel] += source[i * sourceNumChannels + sourceChannel] * gainStart;
-					gainStart += delta;
-				}
-			}
-		}
-
-		static inline void AddAndApplyGain(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
-			uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gain)
-		{
-			for (uint32_t i = 0; i < numSamples; ++i)
-				dest[i * destNumChannels + destChannel] += source[i * sourceNumChannels + sourceChannel] * gain;
-		}
-
-		static bool ContentMatches(const float* buffer1, const float* buffer2, uint32_t frameCount, uint32_t numChannels)
-		{
-			for (uint32_t frame = 0; frame < frameCount; ++frame)
-			{
-				for (uint32_t chan = 0; chan < numChannels; ++chan)
-				{
-					const auto pos = frame * numChannels + chan;
-					if (buffer1[pos] != buffer2[pos])
-						return false;
-				}
-			}
-			return true;
-		}
-	};
-
 }	//	END namespace RAPIER::Audio
@@ -0,0 +1,326 @@
+#include "rppch.h"
+#include "AudioStream.h"
+
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace RAPIER::Audio
+{
+	//  -----------------------------  STREAMING THREAD  -----------------------------  //
+	//	One thread shared by every open stream. It sleeps until a stream drops below its prefetch threshold,
+	//	the audio callback never notifies it, so it also wakes on a short interval to check.
+	class AudioStreamThread
+	{
+	public:
+		static void Register(AudioStream* stream)
+		{
+			std::scoped_lock lock(s_Mutex);
+			s_Streams.push_back(stream);
+
+			if (!s_Thread.joinable())
+			{
+				s_Running = true;
+				s_Thread = std::thread(&AudioStreamThread::Run);
+			}
+		}
+
+		static void Unregister(AudioStream* stream)
+		{
+			std::thread thread;
+			{
+				std::scoped_lock lock(s_Mutex);
+				s_Streams.erase(std::remove(s_Streams.begin(), s_Streams.end(), stream), s_Streams.end());
+
+				if (s_Streams.empty() && s_Thread.joinable())
+				{
+					s_Running = false;
+					thread = std::move(s_Thread);
+				}
+			}
+
+			if (thread.joinable())
+			{
+				s_Condition.notify_one();
+				thread.join();
+			}
+		}
+
+	private:
+		static void Run()
+		{
+			RP_PROFILE_THREAD("AudioStreamThread");
+			AllocationTracker::SetThreadTag(MemoryTag::Audio);
+
+			std::unique_lock lock(s_Mutex);
+			while (s_Running)
+			{
+				for (AudioStream* stream : s_Streams)
+				{
+					if (stream->NeedsRefill())
+						stream->Refill();
+				}
+
+				//	A chunk is ~21ms at 48kHz, this leaves plenty of headroom above the prefetch threshold
+				s_Condition.wait_for(lock, PollInterval);
+			}
+		}
+
+	private:
+		static constexpr auto PollInterval = std::chrono::milliseconds(5);
+
+		static std::thread s_Thread;
+		static std::mutex s_Mutex;
+		static std::condition_variable s_Condition;
+		static std::vector<AudioStream*> s_Streams;
+		static bool s_Running;
+	};
+
+	std::thread AudioStreamThread::s_Thread;
+	std::mutex AudioStreamThread::s_Mutex;
+	std::condition_variable AudioStreamThread::s_Condition;
+	std::vector<AudioStream*> AudioStreamThread::s_Streams;
+	bool AudioStreamThread::s_Running = false;
+
+	//  -----------------------------  DATA SOURCE  -----------------------------  //
+	static ma_result stream_data_source_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+	{
+		AudioStream* stream = static_cast<AudioStreamDataSource*>(pDataSource)->stream;
+
+		bool atEnd = false;
+		const uint64_t framesRead = stream->Read(static_cast<float*>(pFramesOut), frameCount, atEnd);
+		if (pFramesRead)
+			*pFramesRead = framesRead;
+
+		return atEnd && framesRead == 0 ? MA_AT_END : MA_SUCCESS;
+	}
+
+	static ma_result stream_data_source_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
+	{
+		AudioStream* stream = static_cast<AudioStreamDataSource*>(pDataSource)->stream;
+		stream->RequestSeek(frameIndex);
+		return MA_SUCCESS;
+	}
+
+	static ma_result stream_data_source_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+	{
+		AudioStream* stream = static_cast<AudioStreamDataSource*>(pDataSource)->stream;
+		*pFormat = ma_format_f32;
+		*pChannels = stream->GetNumChannels();
+		*pSampleRate = stream->GetSampleRate();
+		ma_get_standard_channel_map(ma_standard_channel_map_default, pChannelMap, channelMapCap, stream->GetNumChannels());
+		return MA_SUCCESS;
+	}
+
+	static ma_result stream_data_source_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+	{
+		AudioStream* stream = static_cast<AudioStreamDataSource*>(pDataSource)->stream;
+		*pCursor = stream->GetCursorInFrames();
+		return MA_SUCCESS;
+	}
+
+	static ma_result stream_data_source_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
+	{
+		AudioStream* stream = static_cast<AudioStreamDataSource*>(pDataSource)->stream;
+		*pLength = stream->GetLengthInFrames();
+		return MA_SUCCESS;
+	}
+
+	static ma_data_source_vtable stream_data_source_vtable = {
+		stream_data_source_read,
+		stream_data_source_seek,
+		stream_data_source_get_data_format,
+		stream_data_source_get_cursor,
+		stream_data_source_get_length
+	};
+
+	//  -----------------------------  AUDIO STREAM  -----------------------------  //
+	AudioStream::~AudioStream()
+	{
+		Close();
+	}
+
+	bool AudioStream::Open(const std::filesystem::path& filepath, const AudioStreamSpecification& specification)
+	{
+		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Audio);
+		RP_CORE_ASSERT(!m_Open, "AudioStream already open");
+		RP_CORE_ASSERT(specification.PrefetchFrames < specification.BufferFrames, "Prefetch threshold must be below the buffer size");
+
+		m_Specification = specification;
+
+		ma_decoder_config decoderConfig = ma_decoder_config_init(ma_format_f32, specification.NumChannels, specification.SampleRate);
+		if (ma_decoder_init_file(filepath.string().c_str(), &decoderConfig, &m_Decoder) != MA_SUCCESS)
+		{
+			RP_CORE_ERROR("AudioStream: Failed to open '{0}'", filepath.string());
+			return false;
+		}
+
+		m_NumChannels = m_Decoder.outputChannels;
+		m_SampleRate = m_Decoder.outputSampleRate;
+
+		ma_uint64 length = 0;
+		ma_decoder_get_length_in_pcm_frames(&m_Decoder, &length);
+		m_LengthInFrames = length;
+
+		ma_data_source_config dataSourceConfig = ma_data_source_config_init();
+		dataSourceConfig.vtable = &stream_data_source_vtable;
+		if (ma_data_source_init(&dataSourceConfig, &m_DataSource.base) != MA_SUCCESS)
+		{
+			ma_decoder_uninit(&m_Decoder);
+			RP_CORE_ERROR("AudioStream: Failed to create data source for '{0}'", filepath.string());
+			return false;
+		}
+		m_DataSource.stream = this;
+
+		m_Ring.Allocate((size_t)specification.BufferFrames * m_NumChannels);
+		m_Looping = specification.Looping;
+		m_DecoderAtEnd = false;
+		m_Failed = false;
+		m_Cursor = 0;
+		m_Underruns = 0;
+		m_SeekRequested = false;
+		m_FlushRequested = false;
+
+		//	Fill the buffer before the first callback so playback starts without a gap
+		Refill();
+
+		m_Open = true;
+		AudioStreamThread::Register(this);
+
+		RP_CORE_TRACE("AudioStream: Opened '{0}' ({1} frames, {2} KB buffered)", filepath.string(), m_LengthInFrames, GetMemorySize() / 1024);
+		return true;
+	}
+
+	void AudioStream::Close()
+	{
+		if (!m_Open)
+			return;
+
+		//	Joins the streaming thread if this was the last stream, it won't touch the decoder afterwards
+		AudioStreamThread::Unregister(this);
+
+		ma_data_source_uninit(&m_DataSource.base);
+		ma_decoder_uninit(&m_Decoder);
+		m_Open = false;
+	}
+
+	bool AudioStream::NeedsRefill() const
+	{
+		if (m_SeekRequested.load(std::memory_order_acquire))
+			return true;
+		if (m_DecoderAtEnd.load(std::memory_order_relaxed) || m_FlushRequested.load(std::memory_order_acquire))
+			return false;
+		return m_Ring.GetReadAvailable() < (size_t)m_Specification.PrefetchFrames * m_NumChannels;
+	}
+
+	bool AudioStream::Refill()
+	{
+		RP_PROFILE_FUNC();
+
+		if (m_SeekRequested.load(std::memory_order_acquire))
+		{
+			if (m_FlushRequested.load(std::memory_order_acquire))
+				return true;	//	Waiting for the audio thread to discard the old frames
+
+			ma_decoder_seek_to_pcm_frame(&m_Decoder, m_SeekTarget.load(std::memory_order_relaxed));
+			m_DecoderAtEnd = false;
+			m_FlushRequested.store(true, std::memory_order_release);
+			return true;
+		}
+
+		float chunk[PCM_FRAME_CHUNK_SIZE * 8];	//	Up to 8 channels
+		const uint32_t chunkFrames = std::min<uint32_t>(PCM_FRAME_CHUNK_SIZE, (uint32_t)(sizeof(chunk) / sizeof(float)) / m_NumChannels);
+
+		bool rewound = false;
+		while (m_Ring.GetWriteAvailable() >= (size_t)chunkFrames * m_NumChannels)
+		{
+			ma_uint64 framesRead = 0;
+			const ma_result result = ma_decoder_read_pcm_frames(&m_Decoder, chunk, chunkFrames, &framesRead);
+			m_Ring.Write(chunk, (size_t)framesRead * m_NumChannels);
+
+			//	Nothing right after going back to the start means an empty or broken file, looping would spin forever
+			if (rewound && framesRead == 0)
+			{
+				RP_CORE_WARN("AudioStream: No frames decoded after looping back ({0}), stopping the stream", (int)result);
+				m_Failed.store(true, std::memory_order_relaxed);
+				m_DecoderAtEnd.store(true, std::memory_order_release);
+				return false;
+			}
+			rewound = false;
+
+			if (framesRead < chunkFrames || result == MA_AT_END)
+			{
+				if (!m_Looping.load(std::memory_order_relaxed))
+				{
+					m_DecoderAtEnd.store(true, std::memory_order_release);
+					return false;
+				}
+				ma_decoder_seek_to_pcm_frame(&m_Decoder, 0);
+				rewound = true;
+			}
+		}
+
+		return true;
+	}
+
+	uint64_t AudioStream::Read(float* output, uint64_t frameCount, bool& atEnd)
+	{
+		atEnd = false;
+
+		if (m_FlushRequested.load(std::memory_order_acquire))
+		{
+			//	The decoder has been moved, everything buffered is from the old position
+			m_Ring.Discard();
+			m_Cursor.store(m_SeekTarget.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			m_FlushRequested.store(false, std::memory_order_relaxed);
+			m_SeekRequested.store(false, std::memory_order_release);
+		}
+
+		//	Silence while a seek is pending is expected, neither the end nor an underrun
+		const bool seeking = m_SeekRequested.load(std::memory_order_acquire);
+
+		uint64_t framesRead = 0;
+		if (!seeking)
+			framesRead = m_Ring.Read(output, (size_t)frameCount * m_NumChannels) / m_NumChannels;
+
+		if (framesRead < frameCount)
+		{
+			//	Only the end if the decoder is done and nothing is left, anything else is an underrun
+			if (!seeking && m_DecoderAtEnd.load(std::memory_order_acquire) && m_Ring.GetReadAvailable() == 0)
+			{
+				atEnd = true;
+			}
+			else
+			{
+				if (!seeking)
+					m_Underruns.fetch_add(1, std::memory_order_relaxed);
+				std::memset(output + framesRead * m_NumChannels, 0, (size_t)(frameCount - framesRead) * m_NumChannels * sizeof(float));
+				framesRead = frameCount;
+			}
+		}
+
+		uint64_t cursor = m_Cursor.load(std::memory_order_relaxed) + framesRead;
+		if (m_LengthInFrames > 0 && m_Looping.load(std::memory_order_relaxed))
+			cursor %= m_LengthInFrames;
+		m_Cursor.store(cursor, std::memory_order_relaxed);
+
+		return framesRead;
+	}
+
+	void AudioStream::RequestSeek(uint64_t frame)
+	{
+		m_SeekTarget.store(frame, std::memory_order_relaxed);
+		m_SeekRequested.store(true, std::memory_order_release);
+	}
+
+	bool AudioStream::ShouldStream(const std::filesystem::path& filepath)
+	{
+		std::error_code error;
+		const uint64_t size = std::filesystem::file_size(filepath, error);
+		return !error && size >= StreamingSizeThreshold;
+	}
+
+}	//	END namespace RAPIER::Audio
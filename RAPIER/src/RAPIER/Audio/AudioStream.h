@@ -0,0 +1,99 @@
+#pragma once
+
+#include "RAPIER/Core/Ref.h"
+#include "RAPIER/Core/LockFreeQueue.h"
+#include "RAPIER/Audio/Audio.h"
+
+#include "miniaudio_incl.h"
+
+#include <filesystem>
+
+namespace RAPIER::Audio
+{
+	struct AudioStreamSpecification
+	{
+		//	Decoded frames kept in memory, 16 chunks is ~340ms of stereo at 48kHz (128KB)
+		uint32_t BufferFrames = PCM_FRAME_CHUNK_SIZE * 16;
+		//	The streaming thread refills once fewer frames than this are buffered
+		uint32_t PrefetchFrames = PCM_FRAME_CHUNK_SIZE * 8;
+		//	0 keeps the file's format
+		uint32_t NumChannels = 0;
+		uint32_t SampleRate = 0;
+		bool Looping = false;
+	};
+
+	class AudioStream;
+
+	struct AudioStreamDataSource
+	{
+		ma_data_source_base base; // <-- Make sure this is always the first member.
+		AudioStream* stream;
+	};
+
+	//	Plays a long file (music, ambience) without decoding it all into memory. A shared streaming thread
+	//	decodes PCM_FRAME_CHUNK_SIZE chunks into a lock-free ring, the audio callback only copies out of it.
+	//	GetDataSource() can be handed to ma_sound_init_from_data_source.
+	class AudioStream : public RefCounted
+	{
+	public:
+		AudioStream() = default;
+		~AudioStream();
+
+		bool Open(const std::filesystem::path& filepath, const AudioStreamSpecification& specification = {});
+		void Close();
+		bool IsOpen() const { return m_Open; }
+
+		ma_data_source* GetDataSource() { return &m_DataSource.base; }
+
+		void SetLooping(bool looping) { m_Looping.store(looping, std::memory_order_relaxed); }
+		bool IsLooping() const { return m_Looping.load(std::memory_order_relaxed); }
+
+		uint32_t GetNumChannels() const { return m_NumChannels; }
+		uint32_t GetSampleRate() const { return m_SampleRate; }
+		uint64_t GetLengthInFrames() const { return m_LengthInFrames; }
+		uint64_t GetCursorInFrames() const { return m_Cursor.load(std::memory_order_relaxed); }
+		//	Reads the audio callback couldn't fully serve, each one is an audible gap
+		uint32_t GetUnderrunCount() const { return m_Underruns.load(std::memory_order_relaxed); }
+		//	Set when a looping stream decodes nothing from the start of the file, the stream has stopped
+		bool HasFailed() const { return m_Failed.load(std::memory_order_relaxed); }
+		uint32_t GetBufferedFrames() const { return (uint32_t)(m_Ring.GetReadAvailable() / m_NumChannels); }
+		size_t GetMemorySize() const { return m_Ring.GetCapacity() * sizeof(float); }
+
+		//	Audio thread, called through the data source
+		uint64_t Read(float* output, uint64_t frameCount, bool& atEnd);
+		void RequestSeek(uint64_t frame);
+
+		//	Files above this size are worth streaming rather than decoding up front
+		static constexpr uint64_t StreamingSizeThreshold = 1024 * 1024;
+		static bool ShouldStream(const std::filesystem::path& filepath);
+	private:
+		//	Streaming thread. Decodes until the ring is full, returns false at the end of a non looping file.
+		bool Refill();
+		bool NeedsRefill() const;
+
+		friend class AudioStreamThread;
+	private:
+		AudioStreamDataSource m_DataSource;
+		ma_decoder m_Decoder;	//	Only touched by the streaming thread once open
+		SPSCRingBuffer<float> m_Ring;
+
+		AudioStreamSpecification m_Specification;
+		uint32_t m_NumChannels = 0;
+		uint32_t m_SampleRate = 0;
+		uint64_t m_LengthInFrames = 0;
+		bool m_Open = false;
+
+		std::atomic<bool> m_Looping = false;
+		std::atomic<bool> m_DecoderAtEnd = false;
+		std::atomic<bool> m_Failed = false;
+		std::atomic<uint64_t> m_Cursor = 0;
+		std::atomic<uint32_t> m_Underruns = 0;
+
+		//	Seek handshake: the audio thread requests, the streaming thread seeks the decoder and asks for a
+		//	flush, the audio thread discards the stale frames and clears both flags
+		std::atomic<uint64_t> m_SeekTarget = 0;
+		std::atomic<bool> m_SeekRequested = false;
+		std::atomic<bool> m_FlushRequested = false;
+	};
+
+}	//	END namespace RAPIER::Audio
@@ -4,40 +4,57 @@
 #include <cassert>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <cstdint>
 
 #include "RAPIER/Audio/SourceManager.h"
 
 
 namespace RAPIER::Audio::DSP
 {
+	enum class DelayLineInterpolation : uint8_t
+	{
+		None,			//	Delay is truncated to whole samples
+		Linear,
+		Lagrange3rd		//	4 taps, smoother for modulated delays (chorus, flanger)
+	};
+
+	//	Multichannel delay line. All channels share one interleaved power-of-two buffer, positions wrap with a mask.
+	//	ProcessBlock is the fast path, PushSample/PopSample are kept for per-sample processing.
+	//	Delays are in samples and clamped to [1, maximumDelayInSamples].
 	class DelayLine
 	{
 	public:
-		explicit DelayLine(int maximumDelayInSamples = 0)
+		explicit DelayLine(int maximumDelayInSamples = 0, DelayLineInterpolation interpolation = DelayLineInterpolation::None)
+			: m_Interpolation(interpolation)
 		{
 			assert(maximumDelayInSamples >= 0);
 
-			m_TotalSize = std::max(4, maximumDelayInSamples + 1);
+			m_MaximumDelay = std::max(1, maximumDelayInSamples);
 			m_SampleRate = 44100.0;
 		}
 
-		void SetDelay(float newDelayInSamples)
+		void SetInterpolation(DelayLineInterpolation interpolation)
 		{
-			auto upperLimit = (float)(m_TotalSize - 1);
+			m_Interpolation = interpolation;
+			SetDelay(m_Delay);
+		}
+		DelayLineInterpolation GetInterpolation() const { return m_Interpolation; }
 
-			if (newDelayInSamples <= 0) newDelayInSamples = 1;
-			assert(newDelayInSamples > 0 && newDelayInSamples < upperLimit);
-        
-			m_Delay = std::clamp(newDelayInSamples, (float)0, upperLimit);
-			m_DelayInt = (int)std::floor(m_Delay);
+		void SetDelay(float newDelayInSamples)
+		{
+			m_Delay = std::clamp(newDelayInSamples, 1.0f, (float)m_MaximumDelay);
+			m_DelayInt = (int)m_Delay;
+			m_DelayFrac = m_Delay - (float)m_DelayInt;
 		}
 		void SetDelayMs(uint32_t milliseconds)
-		{ 
+		{
 			SetDelay(float((double)milliseconds / 1000.0 * m_SampleRate));
 		}
 
 		float GetDelay() const { return m_Delay; }
 		uint32_t GetDelayMs() const { return uint32_t(m_Delay / m_SampleRate * 1000.0); }
+		int GetMaximumDelay() const { return m_MaximumDelay; }
 
 		double GetSampleRate() { return m_SampleRate; }
 
@@ -45,12 +62,15 @@ namespace RAPIER::Audio::DSP
 		{
 			assert(numChannels > 0);
 
-			m_BufferData.resize(numChannels);
-			for (auto& ch : m_BufferData)
-			{
-				ch.resize(m_TotalSize);
-				std::fill(ch.begin(), ch.end(), 0.0f);
-			}
+			m_NumChannels = numChannels;
+
+			//	Room for the longest delay, the extra interpolation taps and one sub-block written ahead of the reads
+			m_Size = 1;
+			while (m_Size < (uint32_t)m_MaximumDelay + InterpolationTaps + SubBlockSize)
+				m_Size <<= 1;
+			m_Mask = m_Size - 1;
+
+			m_Buffer.resize((size_t)(GuardFrames + m_Size) * numChannels);
 
 			m_WritePos.resize(numChannels);
 			m_ReadPos.resize(numChannels);
@@ -65,35 +85,181 @@ namespace RAPIER::Audio::DSP
 			for (auto vec : { &m_WritePos, &m_ReadPos })
 				std::fill(vec->begin(), vec->end(), 0);
 
-			for(auto& ch : m_BufferData)
-				std::fill(ch.begin(), ch.end(), 0.0f);
+			std::fill(m_Buffer.begin(), m_Buffer.end(), 0.0f);
+		}
+
+		//  -----------------------------  BLOCK  -----------------------------  //
+		//	Interleaved input and output with numChannels from SetConfig, input and output may alias.
+		//	Advances every channel, don't mix with PushSample/PopSample on individual channels.
+		void ProcessBlock(const float* input, float* output, uint32_t numFrames)
+		{
+			uint32_t writePos = m_WritePos[0];
+			for (uint32_t offset = 0; offset < numFrames; offset += SubBlockSize)
+			{
+				const uint32_t frames = std::min(SubBlockSize, numFrames - offset);
+				const size_t sampleOffset = (size_t)offset * m_NumChannels;
+
+				Write(input + sampleOffset, writePos, frames);
+				ReadConstant(output + sampleOffset, writePos, frames);
+				writePos = (writePos + frames) & m_Mask;
+			}
+			SetPositions(writePos);
 		}
 
+		//	Same as above with one delay per frame, for chorus/flanger/vibrato style modulation
+		void ProcessBlock(const float* input, float* output, uint32_t numFrames, const float* delayInSamples)
+		{
+			uint32_t writePos = m_WritePos[0];
+			for (uint32_t offset = 0; offset < numFrames; offset += SubBlockSize)
+			{
+				const uint32_t frames = std::min(SubBlockSize, numFrames - offset);
+				const size_t sampleOffset = (size_t)offset * m_NumChannels;
+
+				Write(input + sampleOffset, writePos, frames);
+				for (uint32_t i = 0; i < frames; i++)
+				{
+					SetDelay(delayInSamples[offset + i]);
+					float* out = output + sampleOffset + (size_t)i * m_NumChannels;
+					const float* tap = GetTap((writePos + i) & m_Mask, 0);
+					for (uint32_t ch = 0; ch < m_NumChannels; ch++)
+						out[ch] = Interpolate(tap + ch, m_NumChannels);
+				}
+				writePos = (writePos + frames) & m_Mask;
+			}
+			SetPositions(writePos);
+		}
+
+		//  -----------------------------  PER SAMPLE  -----------------------------  //
 		void PushSample(int channel, float sample)
 		{
-			m_BufferData.at(channel).at(m_WritePos[(size_t)channel]) = sample;
-			m_WritePos[(size_t)channel] = (m_WritePos[(size_t)channel] + m_TotalSize - 1) % m_TotalSize;
+			uint32_t& writePos = m_WritePos[(size_t)channel];
+			m_Buffer[(size_t)(GuardFrames + writePos) * m_NumChannels + channel] = sample;
+			if (writePos >= m_Size - GuardFrames)
+				m_Buffer[(size_t)(writePos + GuardFrames - m_Size) * m_NumChannels + channel] = sample;
+			writePos = (writePos + 1) & m_Mask;
 		}
+		//	Reads the sample pushed delayInSamples pushes ago, the last pushed sample counts as 0
 		float PopSample(int channel, float delayInSamples = -1, bool updateReadPointer = true)
 		{
 			if (delayInSamples >= 0)
 				SetDelay(delayInSamples);
 
-			float result = [&, channel]() { auto index = (m_ReadPos[(size_t)channel] + m_DelayInt) % m_TotalSize;
-											return m_BufferData.at(channel).at(index); }();
+			uint32_t& readPos = m_ReadPos[(size_t)channel];
+			const float result = Interpolate(GetTap(readPos, channel), m_NumChannels);
 
 			if (updateReadPointer)
-				m_ReadPos[(size_t)channel] = (m_ReadPos[(size_t)channel] + m_TotalSize - 1) % m_TotalSize;
+				readPos = (readPos + 1) & m_Mask;
 
 			return result;
 		}
 
+	private:
+		//	Lagrange reads up to 2 samples older and 1 sample newer than the integer delay
+		static constexpr uint32_t InterpolationTaps = 3;
+		//	Copy of the last frames of the ring stored before position 0, taps never need to wrap
+		static constexpr uint32_t GuardFrames = InterpolationTaps;
+		static constexpr uint32_t SubBlockSize = 256;
+
+		void Write(const float* input, uint32_t writePos, uint32_t numFrames)
+		{
+			float* ring = m_Buffer.data() + (size_t)GuardFrames * m_NumChannels;
+
+			const uint32_t first = std::min(numFrames, m_Size - writePos);
+			std::memcpy(ring + (size_t)writePos * m_NumChannels, input, sizeof(float) * first * m_NumChannels);
+			if (first < numFrames)
+				std::memcpy(ring, input + (size_t)first * m_NumChannels, sizeof(float) * (numFrames - first) * m_NumChannels);
+
+			std::memcpy(m_Buffer.data(), ring + (size_t)(m_Size - GuardFrames) * m_NumChannels, sizeof(float) * GuardFrames * m_NumChannels);
+		}
+
+		//	Ring position of the newest sample used by the interpolator for the frame written at position
+		uint32_t GetTapPosition(uint32_t position) const
+		{
+			const int newestTap = m_Interpolation == DelayLineInterpolation::Lagrange3rd ? m_DelayInt - 1 : m_DelayInt;
+			return (position - (uint32_t)newestTap) & m_Mask;
+		}
+		//	Older taps are at negative strides from the returned pointer
+		const float* GetTap(uint32_t position, int channel) const
+		{
+			return m_Buffer.data() + (size_t)(GuardFrames + GetTapPosition(position)) * m_NumChannels + channel;
+		}
+
+		float Interpolate(const float* tap, uint32_t stride) const
+		{
+			switch (m_Interpolation)
+			{
+				case DelayLineInterpolation::Linear:
+					return tap[0] + m_DelayFrac * (tap[-(ptrdiff_t)stride] - tap[0]);
+				case DelayLineInterpolation::Lagrange3rd:
+				{
+					const float frac = m_DelayFrac + 1.0f;
+					const float d1 = frac - 1.0f, d2 = frac - 2.0f, d3 = frac - 3.0f;
+					const float c1 = -d1 * d2 * d3 / 6.0f;
+					const float c2 = d2 * d3 * 0.5f;
+					const float c3 = -d1 * d3 * 0.5f;
+					const float c4 = d1 * d2 / 6.0f;
+					return tap[0] * c1 + frac * (tap[-(ptrdiff_t)stride] * c2 + tap[-2 * (ptrdiff_t)stride] * c3 + tap[-3 * (ptrdiff_t)stride] * c4);
+				}
+				default:
+					return tap[0];
+			}
+		}
+
+		//	Constant delay: the taps of consecutive frames are contiguous up to the ring wrap, so each run is a flat loop
+		void ReadConstant(float* output, uint32_t writePos, uint32_t numFrames) const
+		{
+			const ptrdiff_t stride = (ptrdiff_t)m_NumChannels;
+			const float frac = m_DelayFrac;
+
+			uint32_t frame = 0;
+			while (frame < numFrames)
+			{
+				const uint32_t tapPos = GetTapPosition((writePos + frame) & m_Mask);
+				const float* tap = m_Buffer.data() + (size_t)(GuardFrames + tapPos) * m_NumChannels;
+				const uint32_t run = std::min(numFrames - frame, m_Size - tapPos);
+				const uint32_t count = run * m_NumChannels;
+				float* out = output + (size_t)frame * m_NumChannels;
+
+				switch (m_Interpolation)
+				{
+					case DelayLineInterpolation::Linear:
+						for (uint32_t i = 0; i < count; i++)
+							out[i] = tap[i] + frac * (tap[i - stride] - tap[i]);
+						break;
+					case DelayLineInterpolation::Lagrange3rd:
+					{
+						const float f = frac + 1.0f;
+						const float d1 = f - 1.0f, d2 = f - 2.0f, d3 = f - 3.0f;
+						const float c1 = -d1 * d2 * d3 / 6.0f;
+						const float c2 = f * d2 * d3 * 0.5f;
+						const float c3 = f * -d1 * d3 * 0.5f;
+						const float c4 = f * d1 * d2 / 6.0f;
+						for (uint32_t i = 0; i < count; i++)
+							out[i] = tap[i] * c1 + tap[i - stride] * c2 + tap[i - 2 * stride] * c3 + tap[i - 3 * stride] * c4;
+						break;
+					}
+					default:
+						std::memcpy(out, tap, sizeof(float) * count);
+						break;
+				}
+				frame += run;
+			}
+		}
+
+		void SetPositions(uint32_t position)
+		{
+			std::fill(m_WritePos.begin(), m_WritePos.end(), position);
+			std::fill(m_ReadPos.begin(), m_ReadPos.end(), position);
+		}
+
 	private:
 		double m_SampleRate;
-		std::vector<std::vector<float, SourceManager::Allocator<float>>> m_BufferData;
-		std::vector<int> m_WritePos, m_ReadPos;
-		float m_Delay = 0.0;
-		int m_DelayInt = 0, m_TotalSize = 4;
+		std::vector<float, SourceManager::Allocator<float>> m_Buffer;
+		std::vector<uint32_t> m_WritePos, m_ReadPos;
+		uint32_t m_NumChannels = 0, m_Size = 0, m_Mask = 0;
+		DelayLineInterpolation m_Interpolation;
+		float m_Delay = 1.0f, m_DelayFrac = 0.0f;
+		int m_DelayInt = 1, m_MaximumDelay = 1;
 	};
 
 } // END namespace RAPIER::Audio::DSP
@@ -0,0 +1,43 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+    #include <xmmintrin.h>
+    #define RP_DSP_HAS_MXCSR
+#endif
+
+namespace RAPIER::Audio::DSP
+{
+    // Enables flush-to-zero and denormals-are-zero on the current thread for the lifetime of the scope.
+    // Recursive filters decaying towards silence otherwise fall into denormal arithmetic, which is
+    // many times slower, and checking every sample (undenormalise) defeats vectorization.
+    // No-op on targets without MXCSR.
+    class ScopedNoDenormals
+    {
+    public:
+        ScopedNoDenormals()
+        {
+#ifdef RP_DSP_HAS_MXCSR
+            m_PreviousState = _mm_getcsr();
+            _mm_setcsr(m_PreviousState | FlushToZero | DenormalsAreZero);
+#endif
+        }
+
+        ~ScopedNoDenormals()
+        {
+#ifdef RP_DSP_HAS_MXCSR
+            _mm_setcsr(m_PreviousState);
+#endif
+        }
+
+        ScopedNoDenormals(const ScopedNoDenormals&) = delete;
+        ScopedNoDenormals& operator=(const ScopedNoDenormals&) = delete;
+
+    private:
+#ifdef RP_DSP_HAS_MXCSR
+        static constexpr unsigned int FlushToZero = 0x8000;
+        static constexpr unsigned int DenormalsAreZero = 0x0040;
+        unsigned int m_PreviousState = 0;
+#endif
+    };
+
+} // END namespace RAPIER::Audio::DSP
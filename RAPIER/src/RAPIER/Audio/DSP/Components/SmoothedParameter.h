@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+
+namespace RAPIER::Audio::DSP
+{
+    // DSP node parameter that can be set from any thread. The target is an atomic, the audio thread
+    // picks it up at block boundaries and ramps linearly towards it over the ramp time, so automation
+    // never needs a lock or a filter re-initialization on the caller's thread, and doesn't zipper.
+    class SmoothedParameter
+    {
+    public:
+        explicit SmoothedParameter(float initialValue = 0.0f)
+            : m_Target(initialValue), m_Current(initialValue), m_RampTarget(initialValue) {}
+
+        SmoothedParameter(const SmoothedParameter&) = delete;
+        SmoothedParameter& operator=(const SmoothedParameter&) = delete;
+
+        // Call before processing starts, jumps straight to the target
+        void Reset(double sampleRate, float rampTimeMs)
+        {
+            m_RampFrames = std::max(1u, (uint32_t)(sampleRate * rampTimeMs / 1000.0));
+            SnapToTarget();
+        }
+
+        //  -----------------------------  ANY THREAD  -----------------------------  //
+        void SetTarget(float value) { m_Target.store(value, std::memory_order_relaxed); }
+        float GetTarget() const { return m_Target.load(std::memory_order_relaxed); }
+
+        //  -----------------------------  AUDIO THREAD  -----------------------------  //
+        float GetCurrent() const { return m_Current; }
+
+        // True while ramping or when a new target hasn't been picked up yet
+        bool IsSmoothing() const
+        {
+            return m_FramesRemaining > 0 || GetTarget() != m_RampTarget;
+        }
+
+        // Moves numFrames along the ramp and returns the value reached
+        float Advance(uint32_t numFrames)
+        {
+            const float target = GetTarget();
+            if (target != m_RampTarget)
+            {
+                m_RampTarget = target;
+                m_FramesRemaining = m_RampFrames;
+                m_Step = (target - m_Current) / (float)m_RampFrames;
+            }
+
+            if (m_FramesRemaining > 0)
+            {
+                const uint32_t frames = std::min(numFrames, m_FramesRemaining);
+                m_FramesRemaining -= frames;
+                m_Current = m_FramesRemaining > 0 ? m_Current + m_Step * (float)frames : m_RampTarget;
+            }
+
+            return m_Current;
+        }
+
+        void SnapToTarget()
+        {
+            m_RampTarget = m_Current = GetTarget();
+            m_FramesRemaining = 0;
+            m_Step = 0.0f;
+        }
+
+    private:
+        std::atomic<float> m_Target;
+
+        // Audio thread only
+        float m_Current;
+        float m_RampTarget;
+        float m_Step = 0.0f;
+        uint32_t m_RampFrames = 1;
+        uint32_t m_FramesRemaining = 0;
+    };
+
+} // END namespace RAPIER::Audio::DSP
@@ -4,27 +4,22 @@
 namespace RAPIER::Audio::DSP
 {
 
-    static void hpf_node_process_pcm_frames(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
-    {
-        const float* pFramesIn_0 = ppFramesIn[0]; // Input bus @ index 0.
-        const float* pFramesIn_1 = ppFramesIn[1]; // Input bus @ index 1.
-        float* pFramesOut_0 = ppFramesOut[0];     // Output bus @ index 0.
-
-        auto* node = static_cast<HighPassFilter::hpf_node*>(pNode);
-
-        ma_hpf2_process_pcm_frames(&node->filter, pFramesOut_0, pFramesIn_0, *pFrameCountOut);
-    }
-        
     // TODO: use second input bus for Bypass functionality?
     //       Or it can be used for a modulator signal!
-    static ma_node_vtable high_pass_filter_vtable = {
-        hpf_node_process_pcm_frames,
+    ma_node_vtable HighPassFilter::s_NodeVTable = {
+        &HighPassFilter::ProcessNode,
         nullptr,
         2, // 2 input buses.
         1, // 1 output bus.
         0 // Default flags.
     };
 
+    // Cutoff parameters are normalized to 20kHz, keep the result inside the range the filter is stable for
+    static double ToCutoffFrequency(float cutoffNormalized, double sampleRate)
+    {
+        return std::clamp((double)cutoffNormalized * 20000.0, 10.0, sampleRate * 0.45);
+    }
+
 
     //===========================================================================
     static ma_allocation_callbacks allocation_callbacks;
@@ -71,7 +66,7 @@ namespace RAPIER::Audio::DSP
         ma_uint32 inChannels[2]{ numChannels, numChannels };
         ma_uint32 outChannels[1]{ numChannels };
         ma_node_config nodeConfig = ma_node_config_init();
-        nodeConfig.vtable = &high_pass_filter_vtable;
+        nodeConfig.vtable = &s_NodeVTable;
         nodeConfig.pInputChannels = inChannels;
         nodeConfig.pOutputChannels = outChannels;
         nodeConfig.initialState = ma_node_state_started;
@@ -82,7 +77,10 @@ namespace RAPIER::Audio::DSP
         if(abortIfFailed(result,"Node Init failed"))
             return false;
 
-        ma_hpf2_config config = ma_hpf2_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, m_CutoffMultiplier.load(), 0.707);
+        m_Node.owner = this;
+        m_Cutoff.Reset(m_SampleRate, SmoothingTimeMs);
+
+        ma_hpf2_config config = ma_hpf2_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, ToCutoffFrequency(m_Cutoff.GetCurrent(), m_SampleRate), 0.707);
         result = ma_hpf2_init(&config, &m_Node.filter);
         if(abortIfFailed(result,"Filter Init failed"))
             return false;
@@ -105,29 +103,58 @@ namespace RAPIER::Audio::DSP
         return m_Initialized;
     }
 
-    // TODO: check for the "zipper" noise artefacts
     void HighPassFilter::SetCutoffValue(double cutoffMultiplier)
     {
-        double cutoffFrequency = cutoffMultiplier * 20000.0;
-        ma_hpf2_config config = ma_hpf2_config_init(m_Node.filter.bq.format, m_Node.filter.bq.channels, (ma_uint32)m_SampleRate, cutoffFrequency, 0.707);
+        m_Cutoff.SetTarget((float)cutoffMultiplier);
+    }
+
+    void HighPassFilter::ProcessNode(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
+    {
+        const float* pFramesIn_0 = ppFramesIn[0]; // Input bus @ index 0.
+        float* pFramesOut_0 = ppFramesOut[0];     // Output bus @ index 0.
+
+        auto* node = static_cast<hpf_node*>(pNode);
+        node->owner->Process(pFramesIn_0, pFramesOut_0, *pFrameCountOut);
+    }
+
+    void HighPassFilter::Process(const float* input, float* output, uint32_t frameCount)
+    {
+        if (!m_Cutoff.IsSmoothing())
+        {
+            ma_hpf2_process_pcm_frames(&m_Node.filter, output, input, frameCount);
+            return;
+        }
+
+        const uint32_t numChannels = m_Node.filter.bq.channels;
+        for (uint32_t offset = 0; offset < frameCount; offset += SmoothingBlockSize)
+        {
+            const uint32_t frames = std::min(SmoothingBlockSize, frameCount - offset);
+            if (m_Cutoff.IsSmoothing())
+                UpdateCoefficients(m_Cutoff.Advance(frames));
 
-        // TODO: make sure this thread safe, e.i. using atomic operation to update the values
+            const size_t sampleOffset = (size_t)offset * numChannels;
+            ma_hpf2_process_pcm_frames(&m_Node.filter, output + sampleOffset, input + sampleOffset, frames);
+        }
+    }
+
+    void HighPassFilter::UpdateCoefficients(float cutoffNormalized)
+    {
+        ma_hpf2_config config = ma_hpf2_config_init(m_Node.filter.bq.format, m_Node.filter.bq.channels, (ma_uint32)m_SampleRate, ToCutoffFrequency(cutoffNormalized, m_SampleRate), 0.707);
+
+        // Reinit only recomputes the coefficients, the filter state is kept so there is no discontinuity
         ma_hpf2_reinit(&config, &m_Node.filter);
     }
 
     void HighPassFilter::SetParameter(uint8_t parameterIdx, float value)
     {
         if (parameterIdx == EHPFParameters::CutOffFrequency)
-        {
-            m_CutoffMultiplier = (double)value;
-            SetCutoffValue(m_CutoffMultiplier.load()); // TODO: call this from update loop
-        }
+            SetCutoffValue((double)value);
     }
 
     float HighPassFilter::GetParameter(uint8_t parameterIdx) const
     {
         if (parameterIdx == EHPFParameters::CutOffFrequency)
-            return (float)m_CutoffMultiplier.load();
+            return m_Cutoff.GetTarget();
         else
             return -1.0f;
     }
@@ -143,7 +170,7 @@ namespace RAPIER::Audio::DSP
     std::string HighPassFilter::GetParameterDisplay(uint8_t parameterIdx) const
     {
         if (parameterIdx == EHPFParameters::CutOffFrequency)
-            return std::to_string(m_CutoffMultiplier.load());
+            return std::to_string(m_Cutoff.GetTarget());
         else
             return "Unkonw parameter index";
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "miniaudio_incl.h"
+#include "RAPIER/Audio/DSP/Components/SmoothedParameter.h"
 
 namespace RAPIER::Audio::DSP
 {
@@ -17,6 +18,7 @@ namespace RAPIER::Audio::DSP
 
         bool Initialize(ma_engine* engine, ma_node_base* nodeToInsertAfter);
         void Uninitialize();
+        // Any thread, the audio thread ramps to the new cutoff
         void SetCutoffValue(double cutoffMultiplier);
 
         ma_node_base* GetNode() { return &m_Node.base; }
@@ -32,19 +34,30 @@ namespace RAPIER::Audio::DSP
         // --- Internal members
         bool m_Initialized = false;
 
-        friend void hpf_node_process_pcm_frames(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn,
-                                                                        float** ppFramesOut, ma_uint32* pFrameCountOut);
+        static void ProcessNode(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn,
+                                float** ppFramesOut, ma_uint32* pFrameCountOut);
+        static ma_node_vtable s_NodeVTable;
+
+        // Audio thread, picks up cutoff changes every SmoothingBlockSize frames
+        void Process(const float* input, float* output, uint32_t frameCount);
+        void UpdateCoefficients(float cutoffNormalized);
+
+        static constexpr uint32_t SmoothingBlockSize = 32;
+        static constexpr float SmoothingTimeMs = 20.0f;
+
         struct hpf_node
         {
             ma_node_base base; // <-- Make sure this is always the first member.
             ma_hpf2 filter;
+            HighPassFilter* owner;
         };
 
         hpf_node m_Node;
         double m_SampleRate = 0.0;
         // ~ End of internal members
 
-        std::atomic<double> m_CutoffMultiplier = 0.0;
+        // Normalized, 1.0 is 20kHz
+        SmoothedParameter m_Cutoff{ 0.0f };
     };
 
 } // END namespace RAPIER::Audio::DSP
@@ -4,27 +4,22 @@
 namespace RAPIER::Audio::DSP
 
 {
-    static void lpf_node_process_pcm_frames(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
-    {
-        const float* pFramesIn_0 = ppFramesIn[0]; // Input bus @ index 0.
-        const float* pFramesIn_1 = ppFramesIn[1]; // Input bus @ index 1.
-        float* pFramesOut_0 = ppFramesOut[0];     // Output bus @ index 0.
-
-        auto* node = static_cast<LowPassFilter::lpf_node*>(pNode);
-
-        ma_lpf1_process_pcm_frames(&node->filter, pFramesOut_0, pFramesIn_0, *pFrameCountOut);
-    }
-        
     // TODO: use second input bus for Bypass functionality?
     //       Or it can be used for a modulator signal!
-    static ma_node_vtable low_pass_filter_vtable = {
-        lpf_node_process_pcm_frames,
+    ma_node_vtable LowPassFilter::s_NodeVTable = {
+        &LowPassFilter::ProcessNode,
         nullptr,
         2, // 2 input buses.
         1, // 1 output bus.
         0 // Default flags.
     };
 
+    // Cutoff parameters are normalized to 20kHz, keep the result inside the range the filter is stable for
+    static double ToCutoffFrequency(float cutoffNormalized, double sampleRate)
+    {
+        return std::clamp((double)cutoffNormalized * 20000.0, 10.0, sampleRate * 0.45);
+    }
+
 
     //===========================================================================
     static ma_allocation_callbacks allocation_callbacks;
@@ -72,7 +67,7 @@ namespace RAPIER::Audio::DSP
         ma_uint32 inChannels[2]{ numChannels, numChannels };
         ma_uint32 outChannels[1]{ numChannels };
         ma_node_config nodeConfig = ma_node_config_init();
-        nodeConfig.vtable = &low_pass_filter_vtable;
+        nodeConfig.vtable = &s_NodeVTable;
         nodeConfig.pInputChannels = inChannels;
         nodeConfig.pOutputChannels = outChannels;
         nodeConfig.initialState = ma_node_state_started;
@@ -83,7 +78,10 @@ namespace RAPIER::Audio::DSP
         if (abortIfFailed(result, "Node Init failed"))
             return false;
 
-        ma_lpf1_config config = ma_lpf1_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, m_CutoffMultiplier.load());
+        m_Node.owner = this;
+        m_Cutoff.Reset(m_SampleRate, SmoothingTimeMs);
+
+        ma_lpf1_config config = ma_lpf1_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, ToCutoffFrequency(m_Cutoff.GetCurrent(), m_SampleRate));
         result = ma_lpf1_init(&config, &m_Node.filter);
         if (abortIfFailed(result, "Filter Init failed"))
             return false;
@@ -105,29 +103,58 @@ namespace RAPIER::Audio::DSP
         return m_Initialized;
     }
 
-    // TODO: check for the "zipper" noise artefacts
-    void LowPassFilter::SetCutoffValue(double cutofNormilized)
+    void LowPassFilter::SetCutoffValue(double cutoffMultiplier)
+    {
+        m_Cutoff.SetTarget((float)cutoffMultiplier);
+    }
+
+    void LowPassFilter::ProcessNode(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
     {
-        double cutoffFrequency = cutofNormilized * 20000.0;
-        ma_lpf1_config config = ma_lpf1_config_init(m_Node.filter.format, m_Node.filter.channels, (ma_uint32)m_SampleRate, cutoffFrequency);
+        const float* pFramesIn_0 = ppFramesIn[0]; // Input bus @ index 0.
+        float* pFramesOut_0 = ppFramesOut[0];     // Output bus @ index 0.
 
-        // TODO: make sure this thread safe, e.i. using atomic operation to update the values
+        auto* node = static_cast<lpf_node*>(pNode);
+        node->owner->Process(pFramesIn_0, pFramesOut_0, *pFrameCountOut);
+    }
+
+    void LowPassFilter::Process(const float* input, float* output, uint32_t frameCount)
+    {
+        if (!m_Cutoff.IsSmoothing())
+        {
+            ma_lpf1_process_pcm_frames(&m_Node.filter, output, input, frameCount);
+            return;
+        }
+
+        const uint32_t numChannels = m_Node.filter.channels;
+        for (uint32_t offset = 0; offset < frameCount; offset += SmoothingBlockSize)
+        {
+            const uint32_t frames = std::min(SmoothingBlockSize, frameCount - offset);
+            if (m_Cutoff.IsSmoothing())
+                UpdateCoefficients(m_Cutoff.Advance(frames));
+
+            const size_t sampleOffset = (size_t)offset * numChannels;
+            ma_lpf1_process_pcm_frames(&m_Node.filter, output + sampleOffset, input + sampleOffset, frames);
+        }
+    }
+
+    void LowPassFilter::UpdateCoefficients(float cutoffNormalized)
+    {
+        ma_lpf1_config config = ma_lpf1_config_init(m_Node.filter.format, m_Node.filter.channels, (ma_uint32)m_SampleRate, ToCutoffFrequency(cutoffNormalized, m_SampleRate));
+
+        // Reinit only recomputes the coefficients, the filter state is kept so there is no discontinuity
         ma_lpf1_reinit(&config, &m_Node.filter);
     }
 
     void LowPassFilter::SetParameter(uint8_t parameterIdx, float value)
     {
         if (parameterIdx == ELPFParameters::CutOffFrequency)
-        {
-            m_CutoffMultiplier = (double)value;
-            SetCutoffValue(m_CutoffMultiplier.load()); // TODO: call this from update loop
-        }
+            SetCutoffValue((double)value);
     }
 
     float LowPassFilter::GetParameter(uint8_t parameterIdx) const
     {
         if (parameterIdx == ELPFParameters::CutOffFrequency)
-            return (float)m_CutoffMultiplier.load();
+            return m_Cutoff.GetTarget();
         else
             return -1.0f;
     }
@@ -143,7 +170,7 @@ namespace RAPIER::Audio::DSP
     std::string LowPassFilter::GetParameterDisplay(uint8_t parameterIdx) const
     {
         if (parameterIdx == ELPFParameters::CutOffFrequency)
-            return std::to_string(m_CutoffMultiplier.load());
+            return std::to_string(m_Cutoff.GetTarget());
         else
             return "Unkonw parameter index";
     }
@@ -0,0 +1,392 @@
+#include <rppch.h>
+#include "Reverb.h"
+
+#include "RAPIER/Audio/DSP/Components/ScopedNoDenormals.h"
+#include "RAPIER/Audio/DSP/Components/tuning.h"
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RP_REVERB_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace RAPIER::Audio::DSP
+{
+    ma_node_vtable Reverb::s_NodeVTable = {
+        &Reverb::ProcessNode,
+        nullptr,
+        1, // 1 input bus.
+        1, // 1 output bus.
+        0 // Default flags.
+    };
+
+    static constexpr int combTunings[2][numcombs] = {
+        { combtuningL1, combtuningL2, combtuningL3, combtuningL4, combtuningL5, combtuningL6, combtuningL7, combtuningL8 },
+        { combtuningR1, combtuningR2, combtuningR3, combtuningR4, combtuningR5, combtuningR6, combtuningR7, combtuningR8 }
+    };
+    static constexpr int allPassTunings[2][numallpasses] = {
+        { allpasstuningL1, allpasstuningL2, allpasstuningL3, allpasstuningL4 },
+        { allpasstuningR1, allpasstuningR2, allpasstuningR3, allpasstuningR4 }
+    };
+    static constexpr float allPassFeedback = 0.5f;
+
+
+    //===========================================================================
+    static ma_allocation_callbacks allocation_callbacks;
+
+    Reverb::Reverb()
+    {
+        static_assert(NumCombs == numcombs && NumAllPasses == numallpasses, "Reverb lanes don't match the Freeverb tuning");
+
+        m_Parameters[PreDelay].SetTarget(0.0f);
+        m_Parameters[RoomSize].SetTarget(initialroom);
+        m_Parameters[Damp].SetTarget(initialdamp);
+        m_Parameters[Width].SetTarget(initialwidth);
+        m_Parameters[Wet].SetTarget(initialwet);
+        m_Parameters[Dry].SetTarget(initialdry);
+        m_Parameters[Freeze].SetTarget(initialmode);
+    }
+
+    Reverb::~Reverb()
+    {
+        Uninitialize();
+    }
+
+    void Reverb::Uninitialize()
+    {
+        if (m_Initialized)
+        {
+            if (((ma_node_base*)&m_Node)->vtable != nullptr)
+                ma_node_uninit(&m_Node, &allocation_callbacks);
+        }
+
+        m_Initialized = false;
+    }
+
+    bool Reverb::Initialize(ma_engine* engine, ma_node_base* nodeToInsertAfter)
+    {
+        RP_CORE_ASSERT(!m_Initialized);
+
+        auto abortIfFailed = [&](ma_result result, const char* errorMessage)
+        {
+            if (result != MA_SUCCESS)
+            {
+                RP_CORE_ASSERT(false && errorMessage);
+                Uninitialize();
+                return true;
+            }
+
+            return false;
+        };
+
+        uint32_t numChannels = ma_node_get_output_channels(nodeToInsertAfter, 0);
+        RP_CORE_ASSERT(numChannels == 1 || numChannels == 2, "Reverb only supports mono and stereo");
+
+        Prepare(ma_engine_get_sample_rate(engine), numChannels);
+
+        ma_uint32 inChannels[1]{ numChannels };
+        ma_uint32 outChannels[1]{ numChannels };
+        ma_node_config nodeConfig = ma_node_config_init();
+        nodeConfig.vtable = &s_NodeVTable;
+        nodeConfig.pInputChannels = inChannels;
+        nodeConfig.pOutputChannels = outChannels;
+        nodeConfig.initialState = ma_node_state_started;
+
+        ma_result result;
+        allocation_callbacks = engine->pResourceManager->config.allocationCallbacks;
+        result = ma_node_init(&engine->nodeGraph, &nodeConfig, &allocation_callbacks, &m_Node);
+        if (abortIfFailed(result, "Node Init failed"))
+            return false;
+
+        m_Node.reverb = this;
+
+        auto* output = nodeToInsertAfter->pOutputBuses[0].pInputNode;
+
+        // attach to the output of the node that this reverb is connected to
+        result = ma_node_attach_output_bus(&m_Node, 0, output, 0);
+        if (abortIfFailed(result, "Node attach failed"))
+            return false;
+
+        // attach passed in node to the reverb
+        result = ma_node_attach_output_bus(nodeToInsertAfter, 0, &m_Node, 0);
+        if (abortIfFailed(result, "Node attach failed"))
+            return false;
+
+        m_Initialized = true;
+
+        return m_Initialized;
+    }
+
+    void Reverb::Prepare(double sampleRate, uint32_t numChannels)
+    {
+        m_SampleRate = sampleRate;
+        m_NumChannels = numChannels;
+
+        // Freeverb is tuned for 44.1kHz
+        const double scale = sampleRate / 44100.0;
+
+        int32_t longestComb = 0;
+        for (uint32_t ch = 0; ch < 2; ch++)
+        {
+            for (uint32_t i = 0; i < NumCombs; i++)
+            {
+                const int32_t length = std::max(1, (int32_t)(combTunings[ch][i] * scale));
+                m_CombLength[ch * NumCombs + i] = length;
+                longestComb = std::max(longestComb, length);
+            }
+        }
+
+        uint32_t combRows = 1;
+        while (combRows <= (uint32_t)longestComb)
+            combRows <<= 1;
+        m_CombMask = combRows - 1;
+        m_CombWritePos = 0;
+        m_CombBuffer.assign((size_t)combRows * NumCombLanes, 0.0f);
+        m_CombFilterStore.fill(0.0f);
+
+        uint32_t allPassSize = 0;
+        for (uint32_t ch = 0; ch < 2; ch++)
+        {
+            for (uint32_t i = 0; i < NumAllPasses; i++)
+            {
+                m_AllPassOffset[ch][i] = allPassSize;
+                m_AllPassLength[ch][i] = std::max(1u, (uint32_t)(allPassTunings[ch][i] * scale));
+                m_AllPassIndex[ch][i] = 0;
+                allPassSize += m_AllPassLength[ch][i];
+            }
+        }
+        m_AllPassBuffer.assign(allPassSize, 0.0f);
+
+        m_PreDelay = DelayLine((int)(MaxPreDelayMs / 1000.0 * sampleRate));
+        m_PreDelay.SetConfig(1, sampleRate);
+
+        for (SmoothedParameter& parameter : m_Parameters)
+            parameter.Reset(sampleRate, SmoothingTimeMs);
+    }
+
+    void Reverb::ProcessNode(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
+    {
+        auto* node = static_cast<reverb_node*>(pNode);
+        node->reverb->Process(ppFramesIn[0], ppFramesOut[0], *pFrameCountOut);
+    }
+
+    void Reverb::Process(const float* input, float* output, uint32_t frameCount)
+    {
+        ScopedNoDenormals noDenormals;
+
+        m_PreDelay.SetDelay(m_Parameters[PreDelay].GetTarget() / 1000.0f * (float)m_SampleRate);
+
+        const uint32_t numChannels = m_NumChannels;
+        const uint32_t rightChannel = numChannels > 1 ? 1 : 0;
+        float* combBuffer = m_CombBuffer.data();
+        uint32_t writePos = m_CombWritePos;
+
+#ifdef RP_REVERB_SSE
+        constexpr uint32_t NumVectors = NumCombLanes / 4;
+        __m128 vFilterStore[NumVectors];
+        for (uint32_t v = 0; v < NumVectors; v++)
+            vFilterStore[v] = _mm_load_ps(&m_CombFilterStore[v * 4]);
+#endif
+
+        const uint32_t combRows = m_CombMask + 1;
+        float mono[SubBlockSize], combOut[2][SubBlockSize];
+        for (uint32_t offset = 0; offset < frameCount; offset += SubBlockSize)
+        {
+            const uint32_t frames = std::min(SubBlockSize, frameCount - offset);
+            const float* in = input + (size_t)offset * numChannels;
+            float* out = output + (size_t)offset * numChannels;
+
+            // Parameters can be changed from any thread, ramp them once per sub-block
+            const bool freeze = m_Parameters[Freeze].GetTarget() >= freezemode;
+            const float roomSize = m_Parameters[RoomSize].Advance(frames);
+            const float damp = m_Parameters[Damp].Advance(frames);
+            const float wet = m_Parameters[Wet].Advance(frames) * scalewet;
+            const float dry = m_Parameters[Dry].Advance(frames) * scaledry;
+            const float width = m_Parameters[Width].Advance(frames);
+
+            const float feedback = freeze ? 1.0f : roomSize * scaleroom + offsetroom;
+            const float damp1 = freeze ? 0.0f : damp * scaledamp;
+            const float damp2 = 1.0f - damp1;
+            const float gain = freeze ? muted : fixedgain;
+            const float wet1 = wet * (width / 2.0f + 0.5f);
+            const float wet2 = wet * ((1.0f - width) / 2.0f);
+#ifdef RP_REVERB_SSE
+            const __m128 vFeedback = _mm_set1_ps(feedback);
+            const __m128 vDamp1 = _mm_set1_ps(damp1);
+            const __m128 vDamp2 = _mm_set1_ps(damp2);
+#endif
+
+            for (uint32_t i = 0; i < frames; i++)
+                mono[i] = (in[i * numChannels] + in[i * numChannels + rightChannel]) * gain;
+
+            m_PreDelay.ProcessBlock(mono, mono, frames);
+
+            // --- Combs, all lanes in lockstep. Split in runs where neither the write row nor any
+            //     lane's read row wraps, within a run each lane just steps one row per frame.
+            for (uint32_t i = 0; i < frames;)
+            {
+                uint32_t run = std::min(frames - i, combRows - writePos);
+                const float* readLane[NumCombLanes];
+                for (uint32_t lane = 0; lane < NumCombLanes; lane++)
+                {
+                    const uint32_t readRow = (writePos - (uint32_t)m_CombLength[lane]) & m_CombMask;
+                    run = std::min(run, combRows - readRow);
+                    readLane[lane] = combBuffer + (size_t)readRow * NumCombLanes + lane;
+                }
+
+                float* writeRow = combBuffer + (size_t)writePos * NumCombLanes;
+                for (uint32_t k = 0; k < run; k++, writeRow += NumCombLanes)
+                {
+                    const size_t row = (size_t)k * NumCombLanes;
+#ifdef RP_REVERB_SSE
+                    const __m128 vInput = _mm_set1_ps(mono[i + k]);
+                    __m128 vSum[2] = { _mm_setzero_ps(), _mm_setzero_ps() };
+                    for (uint32_t v = 0; v < NumVectors; v++)
+                    {
+                        const float* const* lanes = readLane + v * 4;
+                        const __m128 vDelayed = _mm_setr_ps(lanes[0][row], lanes[1][row], lanes[2][row], lanes[3][row]);
+
+                        vFilterStore[v] = _mm_add_ps(_mm_mul_ps(vDelayed, vDamp2), _mm_mul_ps(vFilterStore[v], vDamp1));
+                        _mm_storeu_ps(writeRow + v * 4, _mm_add_ps(vInput, _mm_mul_ps(vFilterStore[v], vFeedback)));
+
+                        vSum[v / (NumVectors / 2)] = _mm_add_ps(vSum[v / (NumVectors / 2)], vDelayed);
+                    }
+
+                    alignas(16) float sums[8];
+                    _mm_store_ps(sums, vSum[0]);
+                    _mm_store_ps(sums + 4, vSum[1]);
+                    combOut[0][i + k] = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+                    combOut[1][i + k] = (sums[4] + sums[5]) + (sums[6] + sums[7]);
+#else
+                    float sum[2] = { 0.0f, 0.0f };
+                    for (uint32_t lane = 0; lane < NumCombLanes; lane++)
+                    {
+                        const float delayed = readLane[lane][row];
+                        m_CombFilterStore[lane] = delayed * damp2 + m_CombFilterStore[lane] * damp1;
+                        writeRow[lane] = mono[i + k] + m_CombFilterStore[lane] * feedback;
+                        sum[lane / NumCombs] += delayed;
+                    }
+                    combOut[0][i + k] = sum[0];
+                    combOut[1][i + k] = sum[1];
+#endif
+                }
+
+                writePos = (writePos + run) & m_CombMask;
+                i += run;
+            }
+
+            for (uint32_t i = 0; i < frames; i++)
+            {
+                // --- All passes in series, one chain per channel
+                float channelOut[2] = { combOut[0][i], combOut[1][i] };
+                for (uint32_t ch = 0; ch < 2; ch++)
+                {
+                    float sample = channelOut[ch];
+                    for (uint32_t a = 0; a < NumAllPasses; a++)
+                    {
+                        float& stored = m_AllPassBuffer[m_AllPassOffset[ch][a] + m_AllPassIndex[ch][a]];
+                        const float bufout = stored;
+                        stored = sample + bufout * allPassFeedback;
+                        sample = bufout - sample;
+
+                        if (++m_AllPassIndex[ch][a] >= m_AllPassLength[ch][a])
+                            m_AllPassIndex[ch][a] = 0;
+                    }
+                    channelOut[ch] = sample;
+                }
+
+                const float* frameIn = in + (size_t)i * numChannels;
+                float* frameOut = out + (size_t)i * numChannels;
+                const float left = channelOut[0] * wet1 + channelOut[1] * wet2;
+                const float right = channelOut[1] * wet1 + channelOut[0] * wet2;
+                if (numChannels > 1)
+                {
+                    frameOut[0] = left + frameIn[0] * dry;
+                    frameOut[1] = right + frameIn[1] * dry;
+                }
+                else
+                {
+                    frameOut[0] = (left + right) * 0.5f + frameIn[0] * dry;
+                }
+            }
+        }
+
+#ifdef RP_REVERB_SSE
+        for (uint32_t v = 0; v < NumVectors; v++)
+            _mm_store_ps(&m_CombFilterStore[v * 4], vFilterStore[v]);
+#endif
+        m_CombWritePos = writePos;
+    }
+
+    void Reverb::SetParameter(uint8_t parameterIdx, float value)
+    {
+        switch (parameterIdx)
+        {
+            case EReverbParameters::PreDelay: value = std::clamp(value, 0.0f, MaxPreDelayMs); break;
+            case EReverbParameters::Freeze: break;
+            default:
+                if (parameterIdx >= NumParameters)
+                    return;
+                value = std::clamp(value, 0.0f, 1.0f);
+                break;
+        }
+        m_Parameters[parameterIdx].SetTarget(value);
+    }
+
+    float Reverb::GetParameter(uint8_t parameterIdx) const
+    {
+        if (parameterIdx < NumParameters)
+            return m_Parameters[parameterIdx].GetTarget();
+        else
+            return -1.0f;
+    }
+
+    const char* Reverb::GetParameterLabel(uint8_t parameterIdx) const
+    {
+        switch (parameterIdx)
+        {
+            case EReverbParameters::PreDelay: return "ms";
+            case EReverbParameters::Freeze: return "";
+            case EReverbParameters::RoomSize:
+            case EReverbParameters::Damp:
+            case EReverbParameters::Width:
+            case EReverbParameters::Wet:
+            case EReverbParameters::Dry: return "%";
+            default: return "Unkonw parameter index";
+        }
+    }
+
+    std::string Reverb::GetParameterDisplay(uint8_t parameterIdx) const
+    {
+        switch (parameterIdx)
+        {
+            case EReverbParameters::PreDelay: return std::to_string(m_Parameters[PreDelay].GetTarget());
+            case EReverbParameters::Freeze: return m_Parameters[Freeze].GetTarget() >= freezemode ? "On" : "Off";
+            default:
+                if (parameterIdx < NumParameters)
+                    return std::to_string(m_Parameters[parameterIdx].GetTarget() * 100.0f);
+                return "Unkonw parameter index";
+        }
+    }
+
+    const char* Reverb::GetParameterName(uint8_t parameterIdx) const
+    {
+        switch (parameterIdx)
+        {
+            case EReverbParameters::PreDelay: return "Pre-Delay";
+            case EReverbParameters::RoomSize: return "Room Size";
+            case EReverbParameters::Damp: return "Damp";
+            case EReverbParameters::Width: return "Width";
+            case EReverbParameters::Wet: return "Wet";
+            case EReverbParameters::Dry: return "Dry";
+            case EReverbParameters::Freeze: return "Freeze";
+            default: return "Unkonw parameter index";
+        }
+    }
+
+    uint8_t Reverb::GetNumberOfParameters() const
+    {
+        return NumParameters;
+    }
+
+
+} // END namespace RAPIER::Audio::DSP
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "miniaudio_incl.h"
+#include "RAPIER/Audio/DSP/Components/DelayLine.h"
+#include "RAPIER/Audio/DSP/Components/SmoothedParameter.h"
+
+#include <array>
+
+namespace RAPIER::Audio::DSP
+{
+    // Freeverb (Jezar at Dreampoint) as a node graph effect. The 8 comb filters of both channels run
+    // in lockstep as 16 vector lanes sharing one interleaved delay buffer, denormals are flushed
+    // by the FPU (ScopedNoDenormals) instead of being checked per sample.
+    // Continuous parameters are smoothed, coefficients are updated every SubBlockSize frames.
+    struct Reverb
+    {
+    public:
+        Reverb();
+        ~Reverb();
+
+        enum EReverbParameters : uint8_t
+        {
+            PreDelay,
+            RoomSize,
+            Damp,
+            Width,
+            Wet,
+            Dry,
+            Freeze,
+            NumParameters
+        };
+
+        bool Initialize(ma_engine* engine, ma_node_base* nodeToInsertAfter);
+        void Uninitialize();
+
+        // Allocates the delay buffers, called by Initialize. Can be used on its own to run
+        // Process outside of a node graph.
+        void Prepare(double sampleRate, uint32_t numChannels);
+        // Audio thread. Interleaved, 1 or 2 channels.
+        void Process(const float* input, float* output, uint32_t frameCount);
+
+        ma_node_base* GetNode() { return &m_Node.base; }
+
+        void SetParameter(uint8_t parameterIdx, float value);
+        float GetParameter(uint8_t parameterIdx) const;
+        const char* GetParameterLabel(uint8_t parameterIdx) const;
+        std::string GetParameterDisplay(uint8_t parameterIdx) const;
+        const char* GetParameterName(uint8_t parameterIdx) const;
+        uint8_t GetNumberOfParameters() const;
+
+    private:
+        static void ProcessNode(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn,
+                                float** ppFramesOut, ma_uint32* pFrameCountOut);
+        static ma_node_vtable s_NodeVTable;
+
+        static constexpr uint32_t NumCombs = 8;
+        static constexpr uint32_t NumCombLanes = NumCombs * 2; // Left channel combs, then right channel combs
+        static constexpr uint32_t NumAllPasses = 4;
+        static constexpr uint32_t SubBlockSize = 64;
+        static constexpr float SmoothingTimeMs = 50.0f;
+        static constexpr float MaxPreDelayMs = 200.0f;
+
+        // --- Internal members
+        bool m_Initialized = false;
+
+        struct reverb_node
+        {
+            ma_node_base base; // <-- Make sure this is always the first member.
+            Reverb* reverb;
+        };
+
+        reverb_node m_Node;
+        double m_SampleRate = 0.0;
+        uint32_t m_NumChannels = 0;
+
+        // One row of NumCombLanes samples per frame, lane i reads the row written m_CombLength[i] frames ago
+        std::vector<float> m_CombBuffer;
+        uint32_t m_CombMask = 0;
+        uint32_t m_CombWritePos = 0;
+        alignas(16) std::array<int32_t, NumCombLanes> m_CombLength{};
+        alignas(16) std::array<float, NumCombLanes> m_CombFilterStore{};
+
+        // All passes of both channels back to back
+        std::vector<float> m_AllPassBuffer;
+        std::array<std::array<uint32_t, NumAllPasses>, 2> m_AllPassOffset{}, m_AllPassLength{}, m_AllPassIndex{};
+
+        DelayLine m_PreDelay;
+        // ~ End of internal members
+
+        // PreDelay and Freeze are applied as is, the others are ramped
+        std::array<SmoothedParameter, NumParameters> m_Parameters;
+    };
+
+} // END namespace RAPIER::Audio::DSP
@@ -0,0 +1,166 @@
+#include "rppch.h"
+#include "OfflineAudioRenderer.h"
+
+#include "RAPIER/Core/Memory/Memory.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+
+namespace RAPIER::Audio
+{
+	OfflineAudioRenderer::~OfflineAudioRenderer()
+	{
+		Uninitialize();
+	}
+
+	bool OfflineAudioRenderer::Initialize(const OfflineRenderSpecification& spec)
+	{
+		RP_CORE_ASSERT(!m_Initialized, "OfflineAudioRenderer already initialized");
+		RP_CORE_ASSERT(spec.NumChannels > 0 && spec.SampleRate > 0 && spec.BlockSize > 0, "Invalid offline render specification");
+
+		m_Specification = spec;
+
+		//	The engine always wants a device, it gets one on the null backend that is never started.
+		//	An engine given its own device leaves reading the graph to the caller, which is Render().
+		const ma_backend backend = ma_backend_null;
+		ma_result result = ma_context_init(&backend, 1, nullptr, &m_Context);
+		if (result != MA_SUCCESS)
+		{
+			RP_CORE_ERROR("OfflineAudioRenderer: Failed to initialize null context ({0})", (int)result);
+			return false;
+		}
+
+		ma_device_config deviceConfig = ma_device_config_init(ma_device_type_playback);
+		deviceConfig.playback.format = ma_format_f32;
+		deviceConfig.playback.channels = spec.NumChannels;
+		deviceConfig.sampleRate = spec.SampleRate;
+		deviceConfig.dataCallback = [](ma_device*, void*, const void*, ma_uint32) {};
+		result = ma_device_init(&m_Context, &deviceConfig, &m_Device);
+		if (result != MA_SUCCESS)
+		{
+			RP_CORE_ERROR("OfflineAudioRenderer: Failed to initialize null device ({0})", (int)result);
+			ma_context_uninit(&m_Context);
+			return false;
+		}
+
+		ma_engine_config engineConfig = ma_engine_config_init();
+		engineConfig.pDevice = &m_Device;
+		engineConfig.noAutoStart = MA_TRUE;
+		result = ma_engine_init(&engineConfig, &m_Engine);
+		if (result != MA_SUCCESS)
+		{
+			RP_CORE_ERROR("OfflineAudioRenderer: Failed to initialize engine ({0})", (int)result);
+			ma_device_uninit(&m_Device);
+			ma_context_uninit(&m_Context);
+			return false;
+		}
+
+		m_Initialized = true;
+		return true;
+	}
+
+	void OfflineAudioRenderer::Uninitialize()
+	{
+		if (!m_Initialized)
+			return;
+
+		ma_engine_uninit(&m_Engine);
+		ma_device_uninit(&m_Device);
+		ma_context_uninit(&m_Context);
+		m_Initialized = false;
+	}
+
+	uint64_t OfflineAudioRenderer::RenderBlock(float* output, uint64_t frameCount)
+	{
+		const uint64_t blockFrames = std::min<uint64_t>(frameCount, m_Specification.BlockSize);
+
+		if (m_UpdateCallback)
+			m_UpdateCallback(Timestep((float)blockFrames / (float)m_Specification.SampleRate));
+
+		ma_uint32 framesRead = 0;
+		ma_node_graph_read_pcm_frames(&m_Engine.nodeGraph, output, (ma_uint32)blockFrames, &framesRead);
+		return framesRead;
+	}
+
+	uint64_t OfflineAudioRenderer::Render(float* output, uint64_t frameCount)
+	{
+		RP_PROFILE_FUNC();
+		RP_CORE_ASSERT(m_Initialized, "OfflineAudioRenderer not initialized");
+		RP_MEMORY_TAG(Audio);
+
+		Timer timer;
+		uint64_t framesRendered = 0;
+		while (framesRendered < frameCount)
+		{
+			const uint64_t framesRead = RenderBlock(output + framesRendered * m_Specification.NumChannels, frameCount - framesRendered);
+			if (framesRead == 0)
+				break;
+			framesRendered += framesRead;
+		}
+
+		m_LastRenderStats.FramesRendered = framesRendered;
+		m_LastRenderStats.RenderTimeMs = timer.ElapsedMillis();
+		return framesRendered;
+	}
+
+	Buffer OfflineAudioRenderer::RenderToBuffer(uint64_t frameCount)
+	{
+		const uint64_t size = frameCount * m_Specification.NumChannels * sizeof(float);
+		if (size > std::numeric_limits<uint32_t>::max())
+		{
+			RP_CORE_ERROR("OfflineAudioRenderer: {0} frames do not fit in a Buffer, use RenderToWAV instead", frameCount);
+			return {};
+		}
+
+		Buffer buffer;
+		buffer.Allocate((uint32_t)size);
+		buffer.ZeroInitialize();
+		Render(buffer.As<float>(), frameCount);
+		return buffer;
+	}
+
+	bool OfflineAudioRenderer::RenderToWAV(const std::filesystem::path& filepath, uint64_t frameCount)
+	{
+		RP_PROFILE_FUNC();
+		RP_CORE_ASSERT(m_Initialized, "OfflineAudioRenderer not initialized");
+		RP_MEMORY_TAG(Audio);
+
+		ma_encoder_config encoderConfig = ma_encoder_config_init(ma_encoding_format_wav, ma_format_f32, m_Specification.NumChannels, m_Specification.SampleRate);
+		ma_encoder encoder;
+		if (ma_encoder_init_file(filepath.string().c_str(), &encoderConfig, &encoder) != MA_SUCCESS)
+		{
+			RP_CORE_ERROR("OfflineAudioRenderer: Failed to open '{0}' for writing", filepath.string());
+			return false;
+		}
+
+		//	Only one block is resident at a time, long bounces don't need the whole render in memory
+		ScratchScope scratch;
+		float* block = scratch.AllocateArray<float>((size_t)m_Specification.BlockSize * m_Specification.NumChannels);
+
+		Timer timer;
+		uint64_t framesRendered = 0;
+		bool success = true;
+		while (framesRendered < frameCount)
+		{
+			const uint64_t framesRead = RenderBlock(block, frameCount - framesRendered);
+			if (framesRead == 0)
+				break;
+
+			if (ma_encoder_write_pcm_frames(&encoder, block, framesRead) != framesRead)
+			{
+				RP_CORE_ERROR("OfflineAudioRenderer: Failed to write to '{0}'", filepath.string());
+				success = false;
+				break;
+			}
+			framesRendered += framesRead;
+		}
+
+		ma_encoder_uninit(&encoder);
+
+		m_LastRenderStats.FramesRendered = framesRendered;
+		m_LastRenderStats.RenderTimeMs = timer.ElapsedMillis();
+		RP_CORE_INFO("OfflineAudioRenderer: Rendered {0:.2f}s of audio to '{1}' in {2:.2f}ms ({3:.1f}x realtime)",
+			(float)framesRendered / (float)m_Specification.SampleRate, filepath.string(), m_LastRenderStats.RenderTimeMs,
+			m_LastRenderStats.GetRealtimeFactor(m_Specification.SampleRate));
+		return success;
+	}
+
+}	//	END namespace RAPIER::Audio
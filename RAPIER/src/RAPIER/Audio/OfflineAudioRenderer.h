@@ -0,0 +1,76 @@
+#pragma once
+
+#include "RAPIER/Core/Buffer.h"
+#include "RAPIER/Core/Timestep.h"
+#include "RAPIER/Audio/Audio.h"
+
+#include "miniaudio_incl.h"
+
+#include <filesystem>
+#include <functional>
+
+namespace RAPIER::Audio
+{
+	struct OfflineRenderSpecification
+	{
+		uint32_t NumChannels = 2;
+		uint32_t SampleRate = 48000;
+		//	Frames pulled from the graph per read, the update callback runs once per block
+		uint32_t BlockSize = PCM_FRAME_CHUNK_SIZE;
+	};
+
+	struct OfflineRenderStats
+	{
+		uint64_t FramesRendered = 0;
+		float RenderTimeMs = 0.0f;
+
+		//	Seconds of audio rendered per second of wall clock time
+		float GetRealtimeFactor(uint32_t sampleRate) const
+		{
+			return RenderTimeMs > 0.0f ? ((float)FramesRendered / (float)sampleRate) / (RenderTimeMs * 0.001f) : 0.0f;
+		}
+	};
+
+	//	Device-less miniaudio engine. Nodes (DSP::LowPassFilter, DSP::HighPassFilter, ...) attach to
+	//	GetEngine() the same way they do to the live engine, Render pulls the node graph on the calling
+	//	thread as fast as the CPU allows. Given the same graph and input the output is bit identical.
+	class OfflineAudioRenderer
+	{
+	public:
+		using UpdateCallback = std::function<void(Timestep)>;
+
+		OfflineAudioRenderer() = default;
+		~OfflineAudioRenderer();
+
+		bool Initialize(const OfflineRenderSpecification& spec = {});
+		void Uninitialize();
+		bool IsInitialized() const { return m_Initialized; }
+
+		ma_engine* GetEngine() { return &m_Engine; }
+		ma_node* GetEndpoint() { return ma_engine_get_endpoint(&m_Engine); }
+		const OfflineRenderSpecification& GetSpecification() const { return m_Specification; }
+
+		//	Stands in for the AudioThread update callback, called with the block duration before each block
+		void SetUpdateCallback(const UpdateCallback& callback) { m_UpdateCallback = callback; }
+
+		//	Renders frameCount interleaved f32 frames into output, returns the number of frames written
+		uint64_t Render(float* output, uint64_t frameCount);
+		//	Caller owns the returned buffer and must Release() it
+		Buffer RenderToBuffer(uint64_t frameCount);
+		bool RenderToWAV(const std::filesystem::path& filepath, uint64_t frameCount);
+
+		const OfflineRenderStats& GetLastRenderStats() const { return m_LastRenderStats; }
+	private:
+		//	Runs the update callback and reads at most one block from the graph
+		uint64_t RenderBlock(float* output, uint64_t frameCount);
+	private:
+		ma_context m_Context;
+		ma_device m_Device;
+		ma_engine m_Engine;
+		OfflineRenderSpecification m_Specification;
+		UpdateCallback m_UpdateCallback;
+		OfflineRenderStats m_LastRenderStats;
+		bool m_Initialized = false;
+	};
+
+}	//	END namespace RAPIER::Audio
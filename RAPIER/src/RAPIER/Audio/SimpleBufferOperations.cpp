@@ -0,0 +1,287 @@
+#include "rppch.h"
+#include "SimpleBufferOperations.h"
+
+#if defined(__AVX2__)
+	#define RP_AUDIO_SIMD_AVX2
+	#include <immintrin.h>
+#elif defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RP_AUDIO_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define RP_AUDIO_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+#if defined(RP_AUDIO_SIMD_AVX2) || defined(RP_AUDIO_SIMD_SSE2) || defined(RP_AUDIO_SIMD_NEON)
+	#define RP_AUDIO_SIMD
+#endif
+
+namespace RAPIER::Audio
+{
+	//  -----------------------------  SIMD WRAPPERS  -----------------------------  //
+	//	Just enough of a vector type to write each kernel once
+	namespace
+	{
+#if defined(RP_AUDIO_SIMD_AVX2)
+		using VecF = __m256;
+		constexpr uint32_t Width = 8;
+		inline VecF Load(const float* p) { return _mm256_loadu_ps(p); }
+		inline void Store(float* p, VecF v) { _mm256_storeu_ps(p, v); }
+		inline VecF Set1(float f) { return _mm256_set1_ps(f); }
+		inline VecF Add(VecF a, VecF b) { return _mm256_add_ps(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return _mm256_mul_ps(a, b); }
+		inline bool AnyNotEqual(VecF a, VecF b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_NEQ_UQ)) != 0; }
+#elif defined(RP_AUDIO_SIMD_SSE2)
+		using VecF = __m128;
+		constexpr uint32_t Width = 4;
+		inline VecF Load(const float* p) { return _mm_loadu_ps(p); }
+		inline void Store(float* p, VecF v) { _mm_storeu_ps(p, v); }
+		inline VecF Set1(float f) { return _mm_set1_ps(f); }
+		inline VecF Add(VecF a, VecF b) { return _mm_add_ps(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return _mm_mul_ps(a, b); }
+		inline bool AnyNotEqual(VecF a, VecF b) { return _mm_movemask_ps(_mm_cmpneq_ps(a, b)) != 0; }
+#elif defined(RP_AUDIO_SIMD_NEON)
+		using VecF = float32x4_t;
+		constexpr uint32_t Width = 4;
+		inline VecF Load(const float* p) { return vld1q_f32(p); }
+		inline void Store(float* p, VecF v) { vst1q_f32(p, v); }
+		inline VecF Set1(float f) { return vdupq_n_f32(f); }
+		inline VecF Add(VecF a, VecF b) { return vaddq_f32(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return vmulq_f32(a, b); }
+		inline bool AnyNotEqual(VecF a, VecF b)
+		{
+			const uint32x4_t equal = vceqq_f32(a, b);
+			return (vgetq_lane_u32(equal, 0) & vgetq_lane_u32(equal, 1) & vgetq_lane_u32(equal, 2) & vgetq_lane_u32(equal, 3)) == 0;
+		}
+#else
+		constexpr uint32_t Width = 1;
+#endif
+
+#ifdef RP_AUDIO_SIMD
+		//	Frame index of each lane for mono and stereo interleaved ramps
+		alignas(32) constexpr float MonoLaneFrames[8]   = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+		alignas(32) constexpr float StereoLaneFrames[8] = { 0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f };
+#endif
+
+		//	data[i] *= gainStart + delta * frame(i), for 1 or 2 interleaved channels
+		void MultiplyRamp(float* data, uint32_t count, uint32_t numChannels, float gainStart, float delta)
+		{
+			uint32_t i = 0;
+#ifdef RP_AUDIO_SIMD
+			//	Gain from the frame index rather than accumulated, so long ramps don't drift from the scalar tail
+			const VecF laneFrames = Load(numChannels == 1 ? MonoLaneFrames : StereoLaneFrames);
+			const VecF start = Set1(gainStart);
+			const VecF slope = Set1(delta);
+			for (; i + Width <= count; i += Width)
+			{
+				const VecF gain = Add(start, Mul(Add(Set1((float)(i / numChannels)), laneFrames), slope));
+				Store(data + i, Mul(Load(data + i), gain));
+			}
+#endif
+			for (; i < count; i++)
+				data[i] *= gainStart + delta * (float)(i / numChannels);
+		}
+
+		//	dest[i] += source[i] * (gainStart + delta * frame(i)), for 1 or 2 interleaved channels
+		void MultiplyAddRamp(float* dest, const float* source, uint32_t count, uint32_t numChannels, float gainStart, float delta)
+		{
+			uint32_t i = 0;
+#ifdef RP_AUDIO_SIMD
+			const VecF laneFrames = Load(numChannels == 1 ? MonoLaneFrames : StereoLaneFrames);
+			const VecF start = Set1(gainStart);
+			const VecF slope = Set1(delta);
+			for (; i + Width <= count; i += Width)
+			{
+				const VecF gain = Add(start, Mul(Add(Set1((float)(i / numChannels)), laneFrames), slope));
+				Store(dest + i, Add(Load(dest + i), Mul(Load(source + i), gain)));
+			}
+#endif
+			for (; i < count; i++)
+				dest[i] += source[i] * (gainStart + delta * (float)(i / numChannels));
+		}
+
+		//	dest[i] += source[i] * gain
+		void MultiplyAdd(float* dest, const float* source, uint32_t count, float gain)
+		{
+			uint32_t i = 0;
+#ifdef RP_AUDIO_SIMD
+			const VecF g = Set1(gain);
+			for (; i + Width <= count; i += Width)
+				Store(dest + i, Add(Load(dest + i), Mul(Load(source + i), g)));
+#endif
+			for (; i < count; i++)
+				dest[i] += source[i] * gain;
+		}
+
+		//	data[i] *= gain
+		void Multiply(float* data, uint32_t count, float gain)
+		{
+			uint32_t i = 0;
+#ifdef RP_AUDIO_SIMD
+			const VecF g = Set1(gain);
+			for (; i + Width <= count; i += Width)
+				Store(data + i, Mul(Load(data + i), g));
+#endif
+			for (; i < count; i++)
+				data[i] *= gain;
+		}
+	}
+
+	//  -----------------------------  INTERLEAVED  -----------------------------  //
+	void SimpleBufferOperations::ApplyGainRamp(float* data, uint32_t numSamples, uint32_t numChannels, float gainStart, float gainEnd)
+	{
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+
+		if (delta == 0.0f)
+		{
+			Multiply(data, numSamples * numChannels, gainStart);
+			return;
+		}
+
+		if (numChannels <= 2)
+		{
+			MultiplyRamp(data, numSamples * numChannels, numChannels, gainStart, delta);
+			return;
+		}
+
+		for (uint32_t i = 0; i < numSamples; ++i)
+		{
+			const float gain = gainStart + delta * i;
+			for (uint32_t ch = 0; ch < numChannels; ++ch)
+				data[i * numChannels + ch] *= gain;
+		}
+	}
+
+	void SimpleBufferOperations::ApplyGainRampToSingleChannel(float* data, uint32_t numSamples, uint32_t numChannels, uint32_t channel, float gainStart, float gainEnd)
+	{
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+
+		if (numChannels == 1)
+		{
+			MultiplyRamp(data, numSamples, 1, gainStart, delta);
+			return;
+		}
+
+		//	Strided access, no win from vectorizing
+		for (uint32_t i = 0; i < numSamples; ++i)
+			data[i * numChannels + channel] *= gainStart + delta * i;
+	}
+
+	void SimpleBufferOperations::AddAndApplyGainRamp(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
+		uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gainStart, float gainEnd)
+	{
+		if (gainEnd == gainStart)
+		{
+			AddAndApplyGain(dest, source, destChannel, sourceChannel, destNumChannels, sourceNumChannels, numSamples, gainStart);
+			return;
+		}
+
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+
+		if (destNumChannels == 1 && sourceNumChannels == 1)
+		{
+			MultiplyAddRamp(dest, source, numSamples, 1, gainStart, delta);
+			return;
+		}
+
+		dest += destChannel;
+		source += sourceChannel;
+		for (uint32_t i = 0; i < numSamples; ++i)
+			dest[i * destNumChannels] += source[i * sourceNumChannels] * (gainStart + delta * i);
+	}
+
+	void SimpleBufferOperations::AddAndApplyGain(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
+		uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gain)
+	{
+		if (destNumChannels == 1 && sourceNumChannels == 1)
+		{
+			MultiplyAdd(dest, source, numSamples, gain);
+			return;
+		}
+
+		dest += destChannel;
+		source += sourceChannel;
+		for (uint32_t i = 0; i < numSamples; ++i)
+			dest[i * destNumChannels] += source[i * sourceNumChannels] * gain;
+	}
+
+	void SimpleBufferOperations::AddAndApplyGainRamp(float* dest, const float* source, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd)
+	{
+		if (gainEnd == gainStart)
+		{
+			MultiplyAdd(dest, source, numSamples * numChannels, gainStart);
+			return;
+		}
+
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+
+		if (numChannels <= 2)
+		{
+			MultiplyAddRamp(dest, source, numSamples * numChannels, numChannels, gainStart, delta);
+			return;
+		}
+
+		for (uint32_t i = 0; i < numSamples; ++i)
+		{
+			const float gain = gainStart + delta * i;
+			for (uint32_t ch = 0; ch < numChannels; ++ch)
+				dest[i * numChannels + ch] += source[i * numChannels + ch] * gain;
+		}
+	}
+
+	void SimpleBufferOperations::AddAndApplyGain(float* dest, const float* source, uint32_t numChannels, uint32_t numSamples, float gain)
+	{
+		MultiplyAdd(dest, source, numSamples * numChannels, gain);
+	}
+
+	bool SimpleBufferOperations::ContentMatches(const float* buffer1, const float* buffer2, uint32_t frameCount, uint32_t numChannels)
+	{
+		const uint32_t count = frameCount * numChannels;
+		uint32_t i = 0;
+#ifdef RP_AUDIO_SIMD
+		for (; i + Width <= count; i += Width)
+		{
+			if (AnyNotEqual(Load(buffer1 + i), Load(buffer2 + i)))
+				return false;
+		}
+#endif
+		for (; i < count; i++)
+		{
+			if (buffer1[i] != buffer2[i])
+				return false;
+		}
+		return true;
+	}
+
+	//  -----------------------------  PLANAR  -----------------------------  //
+	void SimpleBufferOperations::ApplyGainRampPlanar(float* const* channels, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd)
+	{
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+		for (uint32_t ch = 0; ch < numChannels; ++ch)
+		{
+			if (delta == 0.0f)
+				Multiply(channels[ch], numSamples, gainStart);
+			else
+				MultiplyRamp(channels[ch], numSamples, 1, gainStart, delta);
+		}
+	}
+
+	void SimpleBufferOperations::AddAndApplyGainRampPlanar(float* const* dest, const float* const* source, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd)
+	{
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+		for (uint32_t ch = 0; ch < numChannels; ++ch)
+		{
+			if (delta == 0.0f)
+				MultiplyAdd(dest[ch], source[ch], numSamples, gainStart);
+			else
+				MultiplyAddRamp(dest[ch], source[ch], numSamples, 1, gainStart, delta);
+		}
+	}
+
+	void SimpleBufferOperations::AddAndApplyGainPlanar(float* const* dest, const float* const* source, uint32_t numChannels, uint32_t numSamples, float gain)
+	{
+		for (uint32_t ch = 0; ch < numChannels; ++ch)
+			MultiplyAdd(dest[ch], source[ch], numSamples, gain);
+	}
+
+}	//	END namespace RAPIER::Audio
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RAPIER::Audio
+{
+	//	Gain and mixing kernels used by the voice mixer. Vectorized with AVX2, SSE2 or NEON
+	//	depending on the target the engine is compiled for, with a scalar fallback.
+	//	"numSamples" is the number of frames, i.e. samples per channel.
+	class SimpleBufferOperations
+	{
+	public:
+		//  -----------------------------  INTERLEAVED  -----------------------------  //
+		static void ApplyGainRamp(float* data, uint32_t numSamples, uint32_t numChannels, float gainStart, float gainEnd);
+		static void ApplyGainRampToSingleChannel(float* data, uint32_t numSamples, uint32_t numChannels, uint32_t channel, float gainStart, float gainEnd);
+
+		//	Single channel of source into a single channel of dest
+		static void AddAndApplyGainRamp(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
+			uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gainStart, float gainEnd);
+		static void AddAndApplyGain(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
+			uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gain);
+
+		//	All channels, source and dest share the same channel layout
+		static void AddAndApplyGainRamp(float* dest, const float* source, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd);
+		static void AddAndApplyGain(float* dest, const float* source, uint32_t numChannels, uint32_t numSamples, float gain);
+
+		static bool ContentMatches(const float* buffer1, const float* buffer2, uint32_t frameCount, uint32_t numChannels);
+
+		//  -----------------------------  PLANAR  -----------------------------  //
+		//	One contiguous buffer per channel
+		static void ApplyGainRampPlanar(float* const* channels, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd);
+		static void AddAndApplyGainRampPlanar(float* const* dest, const float* const* source, uint32_t numChannels, uint32_t numSamples, float gainStart, float gainEnd);
+		static void AddAndApplyGainPlanar(float* const* dest, const float* const* source, uint32_t numChannels, uint32_t numSamples, float gain);
+	};
+
+}	//	END namespace RAPIER::Audio
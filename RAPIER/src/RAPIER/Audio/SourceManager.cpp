@@ -0,0 +1,366 @@
+#include "rppch.h"
+#include "RAPIER/Audio/SourceManager.h"
+
+#include <algorithm>
+
+namespace RAPIER::Audio
+{
+	struct SourceEntry
+	{
+		SourceSpecification Specification;
+		float PlaybackPosition = 0.0f;	//	Seconds
+		float StartDelay = 0.0f;		//	Seconds left before the sound reaches the listener
+		float Audibility = 0.0f;
+		uint32_t Voice = InvalidVoice;
+		uint32_t PlayingIndex = 0;		//	Position in SourceManagerData::PlayingSources
+		uint32_t Generation = 0;
+		bool Allocated = false;
+		bool Playing = false;
+		bool Selected = false;			//	Scratch for Update
+	};
+
+	struct SourceManagerData
+	{
+		SourceManagerSpecification Specification;
+		SourceManager::VoiceCallbacks Callbacks;
+		Transform Listener;
+
+		std::vector<SourceEntry> Sources;
+		std::vector<uint32_t> FreeSources;
+		std::vector<uint32_t> PlayingSources;	//	Dense, only these are touched by Update
+
+		std::vector<uint32_t> VoiceOwners;		//	Source index per voice
+		std::vector<uint32_t> FreeVoices;
+
+		std::vector<uint32_t> Candidates;		//	Scratch for Update
+		std::vector<uint32_t> Finished;
+
+		SourceManagerStats Stats;
+	};
+
+	static SourceManagerData s_Data;
+
+	//  -----------------------------  HELPERS  -----------------------------  //
+	static SourceID MakeID(uint32_t index, uint32_t generation)
+	{
+		return ((SourceID)generation << 32) | index;
+	}
+
+	static SourceEntry* GetSource(SourceID id)
+	{
+		const uint32_t index = (uint32_t)(id & 0xffffffff);
+		if (id == InvalidSourceID || index >= s_Data.Sources.size())
+			return nullptr;
+
+		SourceEntry& source = s_Data.Sources[index];
+		if (!source.Allocated || source.Generation != (uint32_t)(id >> 32))
+			return nullptr;
+		return &source;
+	}
+
+	static uint32_t GetIndex(const SourceEntry& source)
+	{
+		return (uint32_t)(&source - s_Data.Sources.data());
+	}
+
+	static void ReleaseVoice(SourceEntry& source)
+	{
+		if (source.Voice == InvalidVoice)
+			return;
+
+		if (s_Data.Callbacks.OnVoiceStop)
+			s_Data.Callbacks.OnVoiceStop(MakeID(GetIndex(source), source.Generation), source.Voice);
+
+		s_Data.VoiceOwners[source.Voice] = InvalidVoice;
+		s_Data.FreeVoices.push_back(source.Voice);
+		source.Voice = InvalidVoice;
+	}
+
+	static void StopSource(SourceEntry& source)
+	{
+		if (!source.Playing)
+			return;
+
+		ReleaseVoice(source);
+
+		//	Swap-remove from the playing list
+		const uint32_t last = s_Data.PlayingSources.back();
+		s_Data.PlayingSources[source.PlayingIndex] = last;
+		s_Data.Sources[last].PlayingIndex = source.PlayingIndex;
+		s_Data.PlayingSources.pop_back();
+
+		source.Playing = false;
+	}
+
+	static float GetDistanceToListener(const SourceSpecification& specification)
+	{
+		return specification.Spatial ? glm::distance(specification.SourceTransform.Position, s_Data.Listener.Position) : 0.0f;
+	}
+
+	//  -----------------------------  LIFETIME  -----------------------------  //
+	void SourceManager::Init(const SourceManagerSpecification& specification)
+	{
+		RP_MEMORY_TAG(Audio);
+		RP_CORE_ASSERT(specification.MaxVoices > 0 && specification.MaxSources > 0, "SourceManager needs at least one voice and one source");
+
+		s_Data.Specification = specification;
+
+		//	Everything is allocated up front, Update never allocates
+		s_Data.Sources.assign(specification.MaxSources, SourceEntry());
+		s_Data.FreeSources.resize(specification.MaxSources);
+		for (uint32_t i = 0; i < specification.MaxSources; i++)
+			s_Data.FreeSources[i] = specification.MaxSources - 1 - i;
+		s_Data.PlayingSources.clear();
+		s_Data.PlayingSources.reserve(specification.MaxSources);
+
+		s_Data.VoiceOwners.assign(specification.MaxVoices, InvalidVoice);
+		s_Data.FreeVoices.resize(specification.MaxVoices);
+		for (uint32_t i = 0; i < specification.MaxVoices; i++)
+			s_Data.FreeVoices[i] = specification.MaxVoices - 1 - i;
+
+		s_Data.Candidates.reserve(specification.MaxSources);
+		s_Data.Finished.reserve(specification.MaxSources);
+		s_Data.Stats = {};
+
+		RP_CORE_INFO("SourceManager: {0} voices, {1} sources", specification.MaxVoices, specification.MaxSources);
+	}
+
+	void SourceManager::Shutdown()
+	{
+		while (!s_Data.PlayingSources.empty())
+			StopSource(s_Data.Sources[s_Data.PlayingSources.back()]);
+
+		s_Data = SourceManagerData();
+	}
+
+	void SourceManager::SetVoiceCallbacks(const VoiceCallbacks& callbacks)
+	{
+		s_Data.Callbacks = callbacks;
+	}
+
+	//  -----------------------------  SOURCES  -----------------------------  //
+	SourceID SourceManager::CreateSource(const SourceSpecification& specification)
+	{
+		if (s_Data.FreeSources.empty())
+		{
+			RP_CORE_WARN("SourceManager: Out of sources ({0})", s_Data.Specification.MaxSources);
+			return InvalidSourceID;
+		}
+
+		const uint32_t index = s_Data.FreeSources.back();
+		s_Data.FreeSources.pop_back();
+
+		SourceEntry& source = s_Data.Sources[index];
+		const uint32_t generation = source.Generation + 1;
+		source = SourceEntry();
+		source.Specification = specification;
+		source.Generation = generation;
+		source.Allocated = true;
+
+		return MakeID(index, generation);
+	}
+
+	void SourceManager::ReleaseSource(SourceID id)
+	{
+		SourceEntry* source = GetSource(id);
+		if (!source)
+			return;
+
+		StopSource(*source);
+		source->Allocated = false;
+		s_Data.FreeSources.push_back(GetIndex(*source));
+	}
+
+	bool SourceManager::IsValid(SourceID id)
+	{
+		return GetSource(id) != nullptr;
+	}
+
+	void SourceManager::Play(SourceID id, float startPosition)
+	{
+		SourceEntry* source = GetSource(id);
+		if (!source)
+			return;
+
+		StopSource(*source);
+
+		source->PlaybackPosition = startPosition;
+		source->StartDelay = source->Specification.PropagationDelay && source->Specification.Spatial
+			? GetDistanceToListener(source->Specification) / SPEED_OF_SOUND : 0.0f;
+		source->Playing = true;
+		source->PlayingIndex = (uint32_t)s_Data.PlayingSources.size();
+		s_Data.PlayingSources.push_back(GetIndex(*source));
+		//	Gets a voice on the next Update if it is audible enough
+	}
+
+	void SourceManager::Stop(SourceID id)
+	{
+		if (SourceEntry* source = GetSource(id))
+			StopSource(*source);
+	}
+
+	bool SourceManager::IsPlaying(SourceID id)
+	{
+		const SourceEntry* source = GetSource(id);
+		return source && source->Playing;
+	}
+
+	bool SourceManager::IsVirtual(SourceID id)
+	{
+		const SourceEntry* source = GetSource(id);
+		return source && source->Playing && source->Voice == InvalidVoice;
+	}
+
+	uint32_t SourceManager::GetVoice(SourceID id)
+	{
+		const SourceEntry* source = GetSource(id);
+		return source ? source->Voice : InvalidVoice;
+	}
+
+	float SourceManager::GetPlaybackPosition(SourceID id)
+	{
+		const SourceEntry* source = GetSource(id);
+		return source ? source->PlaybackPosition : 0.0f;
+	}
+
+	void SourceManager::SetTransform(SourceID id, const Transform& transform)
+	{
+		if (SourceEntry* source = GetSource(id))
+			source->Specification.SourceTransform = transform;
+	}
+
+	void SourceManager::SetVolume(SourceID id, float volume)
+	{
+		if (SourceEntry* source = GetSource(id))
+			source->Specification.Volume = volume;
+	}
+
+	void SourceManager::SetPitch(SourceID id, float pitch)
+	{
+		if (SourceEntry* source = GetSource(id))
+			source->Specification.Pitch = pitch;
+	}
+
+	void SourceManager::SetListener(const Transform& listener)
+	{
+		s_Data.Listener = listener;
+	}
+
+	float SourceManager::GetDistanceAttenuation(const SourceSpecification& specification, float distance)
+	{
+		if (!specification.Spatial)
+			return 1.0f;
+		if (distance >= specification.MaxDistance)
+			return 0.0f;
+
+		const float clamped = std::max(distance, specification.MinDistance);
+		return specification.MinDistance / (specification.MinDistance + specification.Rolloff * (clamped - specification.MinDistance));
+	}
+
+	//  -----------------------------  UPDATE  -----------------------------  //
+	void SourceManager::Update(Timestep ts)
+	{
+		RP_PROFILE_FUNC();
+
+		const float deltaTime = ts.GetSeconds();
+		SourceManagerStats& stats = s_Data.Stats;
+		stats.VoicesStolen = 0;
+
+		s_Data.Candidates.clear();
+		s_Data.Finished.clear();
+
+		//	Advance playback of every playing source, real or virtual, and score the audible ones
+		for (uint32_t index : s_Data.PlayingSources)
+		{
+			SourceEntry& source = s_Data.Sources[index];
+			const SourceSpecification& spec = source.Specification;
+
+			float advance = deltaTime;
+			if (source.StartDelay > 0.0f)
+			{
+				const float waited = std::min(source.StartDelay, advance);
+				source.StartDelay -= waited;
+				advance -= waited;
+			}
+			source.PlaybackPosition += advance * spec.Pitch;
+
+			if (spec.Duration > 0.0f && source.PlaybackPosition >= spec.Duration)
+			{
+				if (!spec.Looping)
+				{
+					s_Data.Finished.push_back(index);
+					continue;
+				}
+				source.PlaybackPosition = std::fmod(source.PlaybackPosition, spec.Duration);
+			}
+
+			source.Audibility = source.StartDelay > 0.0f ? 0.0f
+				: spec.Volume * spec.Priority * GetDistanceAttenuation(spec, GetDistanceToListener(spec));
+			if (source.Audibility < s_Data.Specification.AudibilityThreshold)
+				continue;
+
+			//	Voice owners get a head start, a source has to be clearly louder to steal a voice
+			if (source.Voice != InvalidVoice)
+				source.Audibility *= 1.0f + s_Data.Specification.VoiceStealHysteresis;
+
+			s_Data.Candidates.push_back(index);
+		}
+
+		for (uint32_t index : s_Data.Finished)
+		{
+			SourceEntry& source = s_Data.Sources[index];
+			StopSource(source);
+			if (s_Data.Callbacks.OnSourceFinished)
+				s_Data.Callbacks.OnSourceFinished(MakeID(index, source.Generation));
+		}
+
+		//	Keep the MaxVoices most audible, no full sort needed
+		const uint32_t maxVoices = s_Data.Specification.MaxVoices;
+		auto louder = [](uint32_t a, uint32_t b) { return s_Data.Sources[a].Audibility > s_Data.Sources[b].Audibility; };
+		if (s_Data.Candidates.size() > maxVoices)
+		{
+			std::nth_element(s_Data.Candidates.begin(), s_Data.Candidates.begin() + maxVoices, s_Data.Candidates.end(), louder);
+			s_Data.Candidates.resize(maxVoices);
+		}
+
+		for (uint32_t index : s_Data.Candidates)
+			s_Data.Sources[index].Selected = true;
+
+		//	Virtualize voices whose source didn't make the cut, before handing out voices
+		for (uint32_t voice = 0; voice < maxVoices; voice++)
+		{
+			const uint32_t owner = s_Data.VoiceOwners[voice];
+			if (owner != InvalidVoice && !s_Data.Sources[owner].Selected)
+			{
+				ReleaseVoice(s_Data.Sources[owner]);
+				stats.VoicesStolen++;
+			}
+		}
+
+		for (uint32_t index : s_Data.Candidates)
+		{
+			SourceEntry& source = s_Data.Sources[index];
+			source.Selected = false;
+			if (source.Voice != InvalidVoice)
+				continue;
+
+			RP_CORE_ASSERT(!s_Data.FreeVoices.empty());
+			source.Voice = s_Data.FreeVoices.back();
+			s_Data.FreeVoices.pop_back();
+			s_Data.VoiceOwners[source.Voice] = index;
+
+			if (s_Data.Callbacks.OnVoiceStart)
+				s_Data.Callbacks.OnVoiceStart(MakeID(index, source.Generation), source.Voice, source.PlaybackPosition);
+		}
+
+		stats.PlayingSources = (uint32_t)s_Data.PlayingSources.size();
+		stats.RealVoices = maxVoices - (uint32_t)s_Data.FreeVoices.size();
+		stats.VirtualSources = stats.PlayingSources - stats.RealVoices;
+	}
+
+	const SourceManagerStats& SourceManager::GetStats()
+	{
+		return s_Data.Stats;
+	}
+
+}	//	END namespace RAPIER::Audio
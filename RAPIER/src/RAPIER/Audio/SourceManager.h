@@ -0,0 +1,123 @@
+#pragma once
+
+#include "RAPIER/Audio/Audio.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace RAPIER::Audio
+{
+	//	Generation in the high 32 bits, slot index in the low 32 bits. Stale IDs are ignored.
+	using SourceID = uint64_t;
+	static constexpr SourceID InvalidSourceID = std::numeric_limits<SourceID>::max();
+	static constexpr uint32_t InvalidVoice = std::numeric_limits<uint32_t>::max();
+
+	struct SourceSpecification
+	{
+		Transform SourceTransform;
+		float Volume = 1.0f;
+		float Pitch = 1.0f;
+		float MinDistance = 1.0f;		//	Full volume inside
+		float MaxDistance = 100.0f;		//	Inaudible outside
+		float Rolloff = 1.0f;
+		float Priority = 1.0f;			//	Multiplies audibility when competing for voices
+		float Duration = 0.0f;			//	Seconds, used to advance and end virtual playback. 0 for unknown
+		bool Looping = false;
+		bool Spatial = true;			//	Non spatial sources ignore distance (music, UI)
+		bool PropagationDelay = false;	//	Delay the start by distance / SPEED_OF_SOUND
+	};
+
+	struct SourceManagerSpecification
+	{
+		uint32_t MaxVoices = 64;
+		uint32_t MaxSources = 4096;
+		//	Sources quieter than this stay virtual even if voices are free
+		float AudibilityThreshold = 0.0001f;
+		//	Audibility bonus of sources that already own a voice, avoids voices flipping every update
+		float VoiceStealHysteresis = 0.1f;
+	};
+
+	struct SourceManagerStats
+	{
+		uint32_t PlayingSources = 0;
+		uint32_t RealVoices = 0;
+		uint32_t VirtualSources = 0;
+		uint32_t VoicesStolen = 0;		//	During the last update
+	};
+
+	//	Owns every sound emitter and hands the MaxVoices most audible ones a voice. The rest are virtual,
+	//	their playback position keeps advancing without being mixed, so they resume in the right place
+	//	when they become audible again. Update cost is linear in the number of playing sources and the
+	//	number of mixed voices is fixed.
+	//	Not thread safe, call everything from the thread that drives Update.
+	class SourceManager
+	{
+	public:
+		//	STL allocator for audio buffers, allocations are attributed to MemoryTag::Audio
+		template<typename T>
+		struct Allocator
+		{
+			using value_type = T;
+
+			Allocator() noexcept = default;
+			template<typename U>
+			Allocator(const Allocator<U>&) noexcept {}
+
+			T* allocate(size_t count)
+			{
+				RP_MEMORY_TAG(Audio);
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+			}
+
+			void deallocate(T* pointer, size_t) noexcept
+			{
+				::operator delete(pointer);
+			}
+
+			template<typename U>
+			bool operator==(const Allocator<U>&) const noexcept { return true; }
+			template<typename U>
+			bool operator!=(const Allocator<U>&) const noexcept { return false; }
+		};
+
+		//	Implemented by the mixer. OnVoiceStart gets the playback position to start from in seconds.
+		struct VoiceCallbacks
+		{
+			std::function<void(SourceID source, uint32_t voice, float playbackPosition)> OnVoiceStart;
+			std::function<void(SourceID source, uint32_t voice)> OnVoiceStop;
+			std::function<void(SourceID source)> OnSourceFinished;
+		};
+
+		static void Init(const SourceManagerSpecification& specification = {});
+		static void Shutdown();
+
+		static void SetVoiceCallbacks(const VoiceCallbacks& callbacks);
+
+		static SourceID CreateSource(const SourceSpecification& specification);
+		static void ReleaseSource(SourceID id);
+		static bool IsValid(SourceID id);
+
+		static void Play(SourceID id, float startPosition = 0.0f);
+		static void Stop(SourceID id);
+		static bool IsPlaying(SourceID id);
+		static bool IsVirtual(SourceID id);	//	Playing without a voice
+		static uint32_t GetVoice(SourceID id);
+		static float GetPlaybackPosition(SourceID id);
+
+		static void SetTransform(SourceID id, const Transform& transform);
+		static void SetVolume(SourceID id, float volume);
+		static void SetPitch(SourceID id, float pitch);
+		static void SetListener(const Transform& listener);
+
+		//	Distance attenuation, inverse distance clamped to [MinDistance, MaxDistance]
+		static float GetDistanceAttenuation(const SourceSpecification& specification, float distance);
+
+		//	Advances playback, scores every playing source and reassigns voices
+		static void Update(Timestep ts);
+
+		static const SourceManagerStats& GetStats();
+	};
+
+}	//	END namespace RAPIER::Audio
@@ -2,11 +2,14 @@
 #include "RAPIER/Core/Application.h"
 
 #include "RAPIER/Core/Log.h"
+#include "RAPIER/Core/Memory/Memory.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 
 #include "RAPIER/Renderer/Renderer.h"
 #include "RAPIER/Renderer/RendererAPI.h"
 
 #include "RAPIER/Core/Input.h"
+#include "RAPIER/Core/JobSystem.h"
 
 #include "RAPIER/Script/ScriptEngine.h"
 
@@ -41,7 +44,10 @@ namespace RAPIER
 		windowSpec.Fullscreen = specification.Fullscreen;
 		windowSpec.VSync      = specification.VSync;
 		m_Window = Window::Create(windowSpec);
-		m_Window->SetEventCallback(RP_BIND_EVENT_FN(Application::OnEvent));
+		m_EventQueue.Subscribe<WindowCloseEvent, &Application::OnWindowClose>(*this);
+		m_EventQueue.Subscribe<WindowResizeEvent, &Application::OnWindowResize>(*this);
+		m_EventQueue.SetEventCallback(RP_BIND_EVENT_FN(Application::OnEvent));
+		m_Window->SetEventQueue(&m_EventQueue);
 		if (specification.StartMaximized)
 			m_Window->Maximize();
 		else
@@ -55,6 +61,7 @@ namespace RAPIER
 			PushOverlay(m_ImGuiLayer);
 		}
 
+		JobSystem::Init();
 		ScriptEngine::Init("Resources/Scripts/POMMEL.dll");
 	}
 
@@ -70,6 +77,7 @@ namespace RAPIER
 
 		Renderer::Shutdown();
 		ScriptEngine::Shutdown();
+		JobSystem::Shutdown();
 
 		delete m_Profiler;
 		m_Profiler = nullptr;
@@ -134,6 +142,20 @@ namespace RAPIER
 			{
 				ImGui::Text("%s: %.3fms\n", name, time);
 			}
+
+			if (AllocationTracker::IsEnabled())
+			{
+				ImGui::Separator();
+				const FrameAllocationStats frameStats = AllocationTracker::GetLastFrameStats();
+				ImGui::Text("Allocations/frame: %llu (%.2f KB)\n", frameStats.Count, (float)frameStats.Bytes / 1024.0f);
+				for (uint32_t i = 0; i < (uint32_t)MemoryTag::Count; i++)
+				{
+					const AllocationStats stats = AllocationTracker::GetStats((MemoryTag)i);
+					ImGui::Text("%s: %.2f MB (%llu live)\n", MemoryTagToString((MemoryTag)i), (float)stats.GetCurrentUsage() / (1024.0f * 1024.0f), stats.GetLiveAllocations());
+				}
+				if (ImGui::Button("Dump Memory Stats"))
+					AllocationTracker::WriteJSON("MemoryStats.json");
+			}
 			ImGui::End();
 
 		}
@@ -152,6 +174,7 @@ namespace RAPIER
 		while (m_Running)
 		{
 			RP_PROFILE_FRAME("Mainthread");
+			Memory::BeginFrame();
 
 			float time = (float)glfwGetTime();
 			m_Timestep = time - m_LastFrameTime;
@@ -174,6 +197,8 @@ namespace RAPIER
 			}
 
 			m_Window->OnUpdate();
+			m_EventQueue.Dispatch();
+			AllocationTracker::EndFrame();
 		}
 	}
 
@@ -186,10 +211,6 @@ namespace RAPIER
 	{
 		RP_PROFILE_FUNC();
 
-		EventDispatcher dispatcher(e);
-		dispatcher.Dispatch<WindowCloseEvent>(RP_BIND_EVENT_FN(Application::OnWindowClose));
-		dispatcher.Dispatch<WindowResizeEvent>(RP_BIND_EVENT_FN(Application::OnWindowResize));
-
 		for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it)
 		{
 			if (e.Handled)
@@ -8,6 +8,7 @@
 
 #include "RAPIER/Core/Events/Event.h"
 #include "RAPIER/Core/Events/ApplicationEvent.h"
+#include "RAPIER/Core/Events/EventQueue.h"
 
 
 #include "RAPIER/ImGui/ImGuiLayer.h"
@@ -65,6 +66,7 @@ namespace RAPIER
 		inline void SetShowStats(bool show) { m_ShowStats = show; }
 
 		inline Window& GetWindow() { return *m_Window; }
+		inline EventQueue& GetEventQueue() { return m_EventQueue; }
 
 		static inline Application& Get() { return *s_Instance; }
 
@@ -83,6 +85,7 @@ namespace RAPIER
 		bool OnWindowClose(WindowCloseEvent& e);
 		bool OnWindowResize(WindowResizeEvent& e);
 	private:
+		EventQueue m_EventQueue;	//	Outlives the window, which pushes into it
 		Scope<Window> m_Window;
 		ApplicationSpecification m_Specification;
 		ApplicationCommandLineArgs m_CommandLineArgs;
@@ -2,6 +2,7 @@
 #include "Base.h"
 
 #include "Log.h"
+#include "Memory/Memory.h"
 
 #include "conf/RP_VER.h"	//	contains RAPIER_BUILD_ID
 
@@ -10,6 +11,7 @@ namespace RAPIER
 	void InitalizeCore()
 	{
 		RAPIER::Log::Init();
+		RAPIER::Memory::Init();
 
 		RP_CORE_INFO("RAPIER Engine {}", RAPIER_BUILD_ID);
 		RP_CORE_INFO("Initalizing...");
@@ -18,5 +20,7 @@ namespace RAPIER
 	void ShutdownCore()
 	{
 		RP_CORE_TRACE("Shuting down...");
+		RAPIER::Memory::Shutdown();
+		RAPIER::Log::Shutdown();
 	}
 }
@@ -2,6 +2,7 @@
 
 #include "RAPIER/Core/Base.h"
 #include "RAPIER/Core/Log.h"
+#include "RAPIER/Core/Memory/LinearAllocator.h"
 
 namespace RAPIER
 {
@@ -29,6 +30,20 @@ namespace RAPIER
 			return buffer;
 		}
 
+		//	The memory belongs to the allocator, do NOT call Release() on the returned buffer
+		static Buffer Copy(const void* data, uint32_t size, LinearAllocator& allocator)
+		{
+			Buffer buffer(allocator.Allocate(size), size);
+			memcpy(buffer.Data, data, size);
+			return buffer;
+		}
+
+		//	Arena backed, see Copy(data, size, allocator)
+		static Buffer Allocate(uint32_t size, LinearAllocator& allocator)
+		{
+			return Buffer(size ? allocator.Allocate(size) : nullptr, size);
+		}
+
 		void Allocate(uint32_t size)
 		{
 			delete[] Data;
@@ -68,6 +83,21 @@ namespace RAPIER
 			return buffer;
 		}
 
+		std::byte* ReadBytes(uint32_t size, uint32_t offset, LinearAllocator& allocator)
+		{
+			RP_CORE_ASSERT(offset + size <= Size, "Buffer overflow!");
+			std::byte* buffer = allocator.AllocateArray<std::byte>(size);
+			memcpy(buffer, (std::byte*)Data + offset, size);
+			return buffer;
+		}
+
+		//	Non-owning view into this buffer, no copy is made
+		Buffer View(uint32_t offset, uint32_t size) const
+		{
+			RP_CORE_ASSERT(offset + size <= Size, "Buffer overflow!");
+			return Buffer((std::byte*)Data + offset, size);
+		}
+
 		void Write(void* data, uint32_t size, uint32_t offset = 0)
 		{
 			RP_CORE_ASSERT(offset + size <= Size, "Buffer overflow!");
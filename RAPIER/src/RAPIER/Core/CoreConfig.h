@@ -16,6 +16,10 @@ Contains:
 #ifdef RP_DEBUG
 	#define RP_ENABLE_PROFILING 1
 	#define RP_ENABLE_RENDERER_PROFILING 1
+	#define RP_ENABLE_REF_STATS 1		//	Counts Ref<T> increments/decrements, see Ref.h
+#endif
+#if defined(RP_DEBUG) || defined(RP_RELEASE)
+	#define RP_ENABLE_MEMORY_TRACKING 1	//	Global new/delete hook, see Memory/AllocationTracker.h
 #endif
 #include "RAPIER/Debug/Profiler.h"
 
@@ -23,6 +27,10 @@ Contains:
 //  ------------------------------------------------    MACRO DEFINES    ------------------------------------------------  //
 //  ---------------------------------------------------------------------------------------------------------------------  //
 
+//	Pastes after expanding both sides, so RP_CONCAT(name, __LINE__) gives a unique name per line
+#define RP_CONCAT_IMPL(a, b)	a##b
+#define RP_CONCAT(a, b)			RP_CONCAT_IMPL(a, b)
+
 // glm macros
 #define DrVec2			glm::vec2	//	glm::vec2
 #define DrVec3			glm::vec3	//	glm::vec3
@@ -5,7 +5,8 @@
 
 namespace RAPIER
 {
-	// Currently using BLOCKING events, instead of a buffer. This will be implemented in the future
+	//	Window events are buffered as records in an EventQueue and dispatched once per frame,
+	//	these classes are what the handlers and layers receive
 
 	enum class EventType
 	{
@@ -0,0 +1,96 @@
+#include "rppch.h"
+#include "EventQueue.h"
+
+#include "RAPIER/Core/Events/ApplicationEvent.h"
+#include "RAPIER/Core/Events/KeyEvent.h"
+#include "RAPIER/Core/Events/MouseEvent.h"
+
+namespace RAPIER
+{
+	void EventQueue::Push(const EventRecord& record)
+	{
+		EventRecord* buffer = m_Buffers[m_WriteIndex];
+		uint32_t& count = m_Counts[m_WriteIndex];
+
+		//	Only the newest position or size matters, but never merge across other events so ordering holds
+		if (count > 0 && buffer[count - 1].Type == record.Type
+			&& (record.Type == EventType::MouseMoved || record.Type == EventType::WindowResize))
+		{
+			buffer[count - 1] = record;
+			return;
+		}
+
+		if (count == Capacity)
+		{
+			m_DroppedCount++;
+			return;
+		}
+
+		buffer[count++] = record;
+	}
+
+	bool EventQueue::PushFromThread(const EventRecord& record)
+	{
+		if (m_ThreadQueue.TryPush(record))
+			return true;
+
+		m_ThreadDroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	void EventQueue::Dispatch()
+	{
+		RP_PROFILE_FUNC();
+		RP_CORE_ASSERT(!m_Dispatching, "EventQueue::Dispatch called from an event handler!");
+
+		while (m_ThreadQueue.TryPop([this](EventRecord& record) { Push(record); }));
+
+		//	Swap first, anything pushed by a handler goes to the other buffer for next frame
+		const uint32_t readIndex = m_WriteIndex;
+		m_WriteIndex ^= 1;
+		m_Counts[m_WriteIndex] = 0;
+
+		m_Dispatching = true;
+		for (uint32_t i = 0; i < m_Counts[readIndex]; i++)
+			DispatchRecord(m_Buffers[readIndex][i]);
+		m_Dispatching = false;
+		m_Counts[readIndex] = 0;
+
+		const uint64_t dropped = GetDroppedCount();
+		if (dropped != m_ReportedDroppedCount)
+		{
+			RP_CORE_WARN("EventQueue full, dropped {0} events", dropped - m_ReportedDroppedCount);
+			m_ReportedDroppedCount = dropped;
+		}
+	}
+
+	void EventQueue::DispatchRecord(const EventRecord& record)
+	{
+		//	The concrete event only lives on the stack for the duration of its handlers
+		switch (record.Type)
+		{
+			case EventType::WindowResize:        { WindowResizeEvent e(record.Resize.Width, record.Resize.Height); Deliver(e); break; }
+			case EventType::WindowClose:         { WindowCloseEvent e; Deliver(e); break; }
+			case EventType::KeyPressed:          { KeyPressedEvent e(record.Key.Code, record.Key.RepeatCount); Deliver(e); break; }
+			case EventType::KeyReleased:         { KeyReleasedEvent e(record.Key.Code); Deliver(e); break; }
+			case EventType::KeyTyped:            { KeyTypedEvent e(record.Key.Code); Deliver(e); break; }
+			case EventType::MouseButtonPressed:  { MouseButtonPressedEvent e(record.MouseButton.Button); Deliver(e); break; }
+			case EventType::MouseButtonReleased: { MouseButtonReleasedEvent e(record.MouseButton.Button); Deliver(e); break; }
+			case EventType::MouseMoved:          { MouseMovedEvent e(record.Mouse.X, record.Mouse.Y); Deliver(e); break; }
+			case EventType::MouseScrolled:       { MouseScrolledEvent e(record.Mouse.X, record.Mouse.Y); Deliver(e); break; }
+			default:
+				RP_CORE_ASSERT(false, "Unknown event type!");
+				break;
+		}
+	}
+
+	void EventQueue::Deliver(Event& e)
+	{
+		for (const Handler& handler : m_Handlers[(size_t)e.GetEventType()])
+			e.Handled |= handler.Function(handler.Instance, e);
+
+		if (!e.Handled && m_EventCallback)
+			m_EventCallback(e);
+	}
+
+}	//	END namespace RAPIER
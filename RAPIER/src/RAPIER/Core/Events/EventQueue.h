@@ -0,0 +1,114 @@
+#pragma once
+
+#include "RAPIER/Core/Events/Event.h"
+#include "RAPIER/Core/KeyCodes.h"
+#include "RAPIER/Core/MouseCodes.h"
+#include "RAPIER/Core/LockFreeQueue.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace RAPIER
+{
+	//	Plain copy of one event, small enough to be buffered by value
+	struct EventRecord
+	{
+		struct ResizeData { uint32_t Width, Height; };
+		struct KeyData { KeyCode Code; uint16_t RepeatCount; };
+		struct MouseButtonData { MouseCode Button; };
+		struct MouseData { float X, Y; };	//	Position for MouseMoved, offsets for MouseScrolled
+
+		EventType Type = EventType::None;
+		union
+		{
+			ResizeData Resize;
+			KeyData Key;
+			MouseButtonData MouseButton;
+			MouseData Mouse;
+		};
+
+		EventRecord() : Resize{ 0, 0 } {}
+
+		static EventRecord WindowResize(uint32_t width, uint32_t height) { EventRecord r; r.Type = EventType::WindowResize; r.Resize = { width, height }; return r; }
+		static EventRecord WindowClose() { EventRecord r; r.Type = EventType::WindowClose; return r; }
+		static EventRecord KeyPressed(KeyCode key, uint16_t repeatCount) { EventRecord r; r.Type = EventType::KeyPressed; r.Key = { key, repeatCount }; return r; }
+		static EventRecord KeyReleased(KeyCode key) { EventRecord r; r.Type = EventType::KeyReleased; r.Key = { key, 0 }; return r; }
+		static EventRecord KeyTyped(KeyCode key) { EventRecord r; r.Type = EventType::KeyTyped; r.Key = { key, 0 }; return r; }
+		static EventRecord MouseButtonPressed(MouseCode button) { EventRecord r; r.Type = EventType::MouseButtonPressed; r.MouseButton = { button }; return r; }
+		static EventRecord MouseButtonReleased(MouseCode button) { EventRecord r; r.Type = EventType::MouseButtonReleased; r.MouseButton = { button }; return r; }
+		static EventRecord MouseMoved(float x, float y) { EventRecord r; r.Type = EventType::MouseMoved; r.Mouse = { x, y }; return r; }
+		static EventRecord MouseScrolled(float xOffset, float yOffset) { EventRecord r; r.Type = EventType::MouseScrolled; r.Mouse = { xOffset, yOffset }; return r; }
+	};
+
+	//	Collects a frame's worth of events and dispatches them in one go from Dispatch().
+	//	Records go into a fixed double buffer, a run of MouseMoved or WindowResize records collapses
+	//	into the latest one, and events pushed while dispatching wait for the next frame instead of
+	//	recursing. Nothing is allocated after the handlers are subscribed.
+	class EventQueue
+	{
+	public:
+		using EventCallbackFn = std::function<void(Event&)>;
+
+		static constexpr uint32_t Capacity = 1024;
+		static constexpr size_t ThreadCapacity = 256;
+
+		EventQueue() = default;
+		EventQueue(const EventQueue&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+
+		//	Main thread only, dropped and counted once the frame is full
+		void Push(const EventRecord& record);
+		//	Any thread, picked up by the next Dispatch()
+		bool PushFromThread(const EventRecord& record);
+
+		//	Called with every event after the typed handlers, unless one of them handled it
+		void SetEventCallback(const EventCallbackFn& callback) { m_EventCallback = callback; }
+
+		//	Method is bool (Instance::*)(T&), returning true marks the event handled.
+		//	Subscribe during setup, handlers run in subscription order.
+		template<typename T, auto Method, typename Instance>
+		void Subscribe(Instance& instance)
+		{
+			Handler handler;
+			handler.Instance = &instance;
+			handler.Function = [](void* instance, Event& e) -> bool
+			{
+				return (static_cast<Instance*>(instance)->*Method)(static_cast<T&>(e));
+			};
+			m_Handlers[(size_t)T::GetStaticType()].push_back(handler);
+		}
+
+		//	Main thread, once per frame
+		void Dispatch();
+
+		uint32_t GetPendingCount() const { return m_Counts[m_WriteIndex]; }
+		uint64_t GetDroppedCount() const { return m_DroppedCount + m_ThreadDroppedCount.load(std::memory_order_relaxed); }
+	private:
+		void DispatchRecord(const EventRecord& record);
+		void Deliver(Event& e);
+	private:
+		struct Handler
+		{
+			bool (*Function)(void*, Event&) = nullptr;
+			void* Instance = nullptr;
+		};
+
+		static constexpr size_t EventTypeCount = (size_t)EventType::MouseScrolled + 1;
+
+		std::array<std::vector<Handler>, EventTypeCount> m_Handlers;
+		EventCallbackFn m_EventCallback;
+
+		EventRecord m_Buffers[2][Capacity];
+		uint32_t m_Counts[2] = { 0, 0 };
+		uint32_t m_WriteIndex = 0;
+		bool m_Dispatching = false;
+
+		uint64_t m_DroppedCount = 0;
+		uint64_t m_ReportedDroppedCount = 0;
+		std::atomic<uint64_t> m_ThreadDroppedCount = 0;
+		MPSCQueue<EventRecord, ThreadCapacity> m_ThreadQueue;
+	};
+
+}	//	END namespace RAPIER
@@ -0,0 +1,165 @@
+#include "rppch.h"
+#include "JobSystem.h"
+
+#include "RAPIER/Debug/Profiler.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace RAPIER
+{
+	struct QueuedJob
+	{
+		JobSystem::Job Function;
+		std::atomic<uint32_t>* Pending;
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<QueuedJob> Queue;
+		std::mutex QueueMutex;
+		std::condition_variable QueueCondition;
+		bool Running = false;
+	};
+
+	static JobSystemData s_Data;
+
+	static bool TryPopJob(QueuedJob& outJob)
+	{
+		std::scoped_lock lock(s_Data.QueueMutex);
+		if (s_Data.Queue.empty())
+			return false;
+
+		outJob = std::move(s_Data.Queue.front());
+		s_Data.Queue.pop_front();
+		return true;
+	}
+
+	static void RunJob(QueuedJob& job)
+	{
+		job.Function();
+		job.Pending->fetch_sub(1, std::memory_order_release);
+	}
+
+	static void WorkerLoop()
+	{
+		RP_PROFILE_THREAD("JobSystem Worker");
+
+		while (true)
+		{
+			QueuedJob job;
+			{
+				std::unique_lock lock(s_Data.QueueMutex);
+				s_Data.QueueCondition.wait(lock, [] { return !s_Data.Queue.empty() || !s_Data.Running; });
+				if (!s_Data.Running && s_Data.Queue.empty())
+					return;
+
+				job = std::move(s_Data.Queue.front());
+				s_Data.Queue.pop_front();
+			}
+
+			RunJob(job);
+		}
+	}
+
+	void JobSystem::Init(uint32_t numWorkers)
+	{
+		RP_PROFILE_FUNC();
+		RP_CORE_ASSERT(!s_Data.Running, "JobSystem already initialized!");
+
+		if (numWorkers == 0)
+			numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		s_Data.Running = true;
+		s_Data.Workers.reserve(numWorkers);
+		for (uint32_t i = 0; i < numWorkers; i++)
+			s_Data.Workers.emplace_back(WorkerLoop);
+
+		RP_CORE_INFO("JobSystem: {0} worker threads", numWorkers);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		{
+			std::scoped_lock lock(s_Data.QueueMutex);
+			s_Data.Running = false;
+		}
+		s_Data.QueueCondition.notify_all();
+
+		for (std::thread& worker : s_Data.Workers)
+			worker.join();
+		s_Data.Workers.clear();
+	}
+
+	void JobSystem::Execute(JobCounter& counter, Job job)
+	{
+		counter.m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		if (s_Data.Workers.empty())
+		{
+			QueuedJob inlineJob = { std::move(job), &counter.m_Pending };
+			RunJob(inlineJob);
+			return;
+		}
+
+		{
+			std::scoped_lock lock(s_Data.QueueMutex);
+			s_Data.Queue.push_back({ std::move(job), &counter.m_Pending });
+		}
+		s_Data.QueueCondition.notify_one();
+	}
+
+	void JobSystem::Dispatch(JobCounter& counter, uint32_t count, uint32_t groupSize, IndexedJob job)
+	{
+		if (count == 0)
+			return;
+
+		groupSize = std::max(groupSize, 1u);
+		const uint32_t groupCount = (count + groupSize - 1) / groupSize;
+
+		//	Shared by every group rather than copied into each
+		auto sharedJob = std::make_shared<IndexedJob>(std::move(job));
+		for (uint32_t group = 0; group < groupCount; group++)
+		{
+			const uint32_t begin = group * groupSize;
+			const uint32_t end = std::min(begin + groupSize, count);
+			Execute(counter, [sharedJob, begin, end]()
+			{
+				for (uint32_t i = begin; i < end; i++)
+					(*sharedJob)(i);
+			});
+		}
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t groupSize, const IndexedJob& job)
+	{
+		RP_PROFILE_FUNC();
+
+		JobCounter counter;
+		Dispatch(counter, count, groupSize, job);
+		Wait(counter);
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		RP_PROFILE_FUNC();
+
+		while (counter.IsBusy())
+		{
+			QueuedJob job;
+			if (TryPopJob(job))
+				RunJob(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return (uint32_t)s_Data.Workers.size();
+	}
+
+}	//	END namespace RAPIER
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace RAPIER
+{
+	//	Tracks a batch of jobs, busy until every job executed with it has finished
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsBusy() const { return m_Pending.load(std::memory_order_acquire) > 0; }
+	private:
+		std::atomic<uint32_t> m_Pending = 0;
+
+		friend class JobSystem;
+	};
+
+	//	Fixed pool of worker threads for short, independent jobs (physics steps, batched queries).
+	//	Jobs must not touch the registry or anything else the main thread may be modifying meanwhile.
+	//	Without workers (Init not called, or a single core machine) every job runs inline.
+	class JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+		using IndexedJob = std::function<void(uint32_t index)>;
+
+		//	0 workers picks one less than the number of hardware threads
+		static void Init(uint32_t numWorkers = 0);
+		static void Shutdown();
+
+		static void Execute(JobCounter& counter, Job job);
+		//	Runs job(i) for i in [0, count), groupSize indices per queued job
+		static void Dispatch(JobCounter& counter, uint32_t count, uint32_t groupSize, IndexedJob job);
+		//	Dispatch and wait, the calling thread works on the batch too
+		static void ParallelFor(uint32_t count, uint32_t groupSize, const IndexedJob& job);
+
+		//	Runs queued jobs while waiting rather than sleeping
+		static void Wait(const JobCounter& counter);
+
+		static uint32_t GetWorkerCount();
+	};
+
+}	//	END namespace RAPIER
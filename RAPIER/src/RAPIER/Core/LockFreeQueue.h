@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace RAPIER
+{
+	//	Bounded multi-producer, single-consumer queue. Elements are constructed in place in
+	//	preallocated cells, so pushing and popping never touch the heap. Based on Dmitry Vyukov's
+	//	bounded MPMC queue, with the consumer side reduced to a plain index.
+	template<typename T, size_t Capacity>
+	class MPSCQueue
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two!");
+	public:
+		MPSCQueue()
+		{
+			for (size_t i = 0; i < Capacity; i++)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		~MPSCQueue()
+		{
+			while (TryPop([](T&) {}));
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		//	Any thread. Returns false without constructing anything when the queue is full.
+		template<typename... Args>
+		bool TryPush(Args&&... args)
+		{
+			Cell* cell;
+			size_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &m_Cells[position & (Capacity - 1)];
+				const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+				if (difference == 0)
+				{
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					return false;	//	Full
+				}
+				else
+				{
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (cell->Storage) T(std::forward<Args>(args)...);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		//	Consumer thread only. Calls consumer(T&) on the oldest element, then destroys it.
+		template<typename Func>
+		bool TryPop(Func&& consumer)
+		{
+			Cell& cell = m_Cells[m_DequeuePosition & (Capacity - 1)];
+			if (cell.Sequence.load(std::memory_order_acquire) != m_DequeuePosition + 1)
+				return false;
+
+			T* element = std::launder(reinterpret_cast<T*>(cell.Storage));
+			consumer(*element);
+			element->~T();
+
+			cell.Sequence.store(m_DequeuePosition + Capacity, std::memory_order_release);
+			m_DequeuePosition++;
+			return true;
+		}
+
+		//	Consumer thread only
+		bool IsEmpty() const
+		{
+			const Cell& cell = m_Cells[m_DequeuePosition & (Capacity - 1)];
+			return cell.Sequence.load(std::memory_order_acquire) != m_DequeuePosition + 1;
+		}
+
+		static constexpr size_t GetCapacity() { return Capacity; }
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			alignas(T) std::byte Storage[sizeof(T)];
+		};
+
+		static constexpr size_t CacheLineSize = 64;
+
+		alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePosition = 0;
+		alignas(CacheLineSize) size_t m_DequeuePosition = 0;
+		alignas(CacheLineSize) Cell m_Cells[Capacity];
+	};
+
+	//	Single-producer, single-consumer ring of trivially copyable elements, sized at runtime.
+	//	Bulk Write/Read copy with at most two memcpy each, neither side ever blocks.
+	template<typename T>
+	class SPSCRingBuffer
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SPSCRingBuffer copies elements with memcpy");
+	public:
+		SPSCRingBuffer() = default;
+		explicit SPSCRingBuffer(size_t minimumCapacity) { Allocate(minimumCapacity); }
+
+		SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+		SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+		//	Rounds up to a power of two. Not thread safe, call before the producer and consumer start.
+		void Allocate(size_t minimumCapacity)
+		{
+			size_t capacity = 2;
+			while (capacity < minimumCapacity)
+				capacity <<= 1;
+
+			m_Buffer = std::make_unique<T[]>(capacity);
+			m_Capacity = capacity;
+			m_WritePosition.store(0, std::memory_order_relaxed);
+			m_ReadPosition.store(0, std::memory_order_relaxed);
+		}
+
+		size_t GetCapacity() const { return m_Capacity; }
+
+		//	Producer thread only. Returns the number of elements written.
+		size_t Write(const T* data, size_t count)
+		{
+			const size_t write = m_WritePosition.load(std::memory_order_relaxed);
+			const size_t read = m_ReadPosition.load(std::memory_order_acquire);
+			count = std::min(count, m_Capacity - (write - read));
+
+			CopyIn(write, data, count);
+			m_WritePosition.store(write + count, std::memory_order_release);
+			return count;
+		}
+
+		//	Consumer thread only. Returns the number of elements read.
+		size_t Read(T* data, size_t count)
+		{
+			const size_t read = m_ReadPosition.load(std::memory_order_relaxed);
+			const size_t write = m_WritePosition.load(std::memory_order_acquire);
+			count = std::min(count, write - read);
+
+			CopyOut(read, data, count);
+			m_ReadPosition.store(read + count, std::memory_order_release);
+			return count;
+		}
+
+		//	Consumer thread only. Drops everything written so far.
+		void Discard()
+		{
+			m_ReadPosition.store(m_WritePosition.load(std::memory_order_acquire), std::memory_order_release);
+		}
+
+		//	Exact from the thread that owns the respective side, a lower bound from the other one
+		size_t GetReadAvailable() const
+		{
+			return m_WritePosition.load(std::memory_order_acquire) - m_ReadPosition.load(std::memory_order_acquire);
+		}
+		size_t GetWriteAvailable() const { return m_Capacity - GetReadAvailable(); }
+	private:
+		void CopyIn(size_t position, const T* data, size_t count)
+		{
+			const size_t index = position & (m_Capacity - 1);
+			const size_t first = std::min(count, m_Capacity - index);
+			std::memcpy(m_Buffer.get() + index, data, first * sizeof(T));
+			std::memcpy(m_Buffer.get(), data + first, (count - first) * sizeof(T));
+		}
+
+		void CopyOut(size_t position, T* data, size_t count) const
+		{
+			const size_t index = position & (m_Capacity - 1);
+			const size_t first = std::min(count, m_Capacity - index);
+			std::memcpy(data, m_Buffer.get() + index, first * sizeof(T));
+			std::memcpy(data + first, m_Buffer.get(), (count - first) * sizeof(T));
+		}
+	private:
+		static constexpr size_t CacheLineSize = 64;
+
+		std::unique_ptr<T[]> m_Buffer;
+		size_t m_Capacity = 0;
+		//	Free running positions, masked on access
+		alignas(CacheLineSize) std::atomic<size_t> m_WritePosition = 0;
+		alignas(CacheLineSize) std::atomic<size_t> m_ReadPosition = 0;
+	};
+
+}	//	END namespace RAPIER
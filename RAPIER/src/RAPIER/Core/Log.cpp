@@ -5,16 +5,178 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #include "RAPIER/Editor/EditorConsole/EditorConsoleSink.h"
 
+#include "RAPIER/Core/LockFreeQueue.h"
+
 #include <filesystem>
+#include <thread>
 
 namespace RAPIER
 {
+	//  -----------------------------  ASYNC BACKEND  -----------------------------  //
+	class AsyncLogSink;
+
+	//	One message, copied out of spdlog's buffers so the caller can return straight away
+	struct LogRecord
+	{
+		static constexpr size_t MaxNameLength = 15;
+		static constexpr size_t MaxPayloadLength = 384;
+
+		AsyncLogSink* Target;
+		spdlog::log_clock::time_point Time;
+		size_t ThreadID;
+		spdlog::level::level_enum Level;
+		uint16_t NameLength;
+		uint16_t PayloadLength;
+		char Name[MaxNameLength];
+		char Payload[MaxPayloadLength];
+
+		LogRecord(AsyncLogSink* target, const spdlog::details::log_msg& msg)
+			: Target(target), Time(msg.time), ThreadID(msg.thread_id), Level(msg.level)
+		{
+			NameLength = (uint16_t)std::min(msg.logger_name.size(), MaxNameLength);
+			memcpy(Name, msg.logger_name.data(), NameLength);
+
+			if (msg.payload.size() <= MaxPayloadLength)
+			{
+				PayloadLength = (uint16_t)msg.payload.size();
+				memcpy(Payload, msg.payload.data(), PayloadLength);
+			}
+			else
+			{
+				PayloadLength = (uint16_t)MaxPayloadLength;
+				memcpy(Payload, msg.payload.data(), MaxPayloadLength - 3);
+				memcpy(Payload + MaxPayloadLength - 3, "...", 3);
+			}
+		}
+	};
+
+	struct AsyncLogData
+	{
+		static constexpr size_t QueueCapacity = 4096;
+
+		MPSCQueue<LogRecord, QueueCapacity> Queue;
+		std::atomic<uint64_t> Pushed = 0;
+		std::atomic<uint64_t> Written = 0;
+		std::atomic<bool> Running = true;
+		std::vector<std::shared_ptr<AsyncLogSink>> Sinks;
+		std::thread Flusher;
+	};
+	//	Heap allocated and only freed by Shutdown, the flusher must not be torn down by static destruction
+	static AsyncLogData* s_AsyncData = nullptr;
+
+	//	Stands in for a logger's real sinks. log() only copies the message into the queue, the
+	//	flusher thread writes it to the wrapped sinks later.
+	class AsyncLogSink : public spdlog::sinks::sink
+	{
+	public:
+		AsyncLogSink(std::vector<spdlog::sink_ptr> sinks)
+			: m_Sinks(std::move(sinks)) {}
+
+		void log(const spdlog::details::log_msg& msg) override
+		{
+			if (s_AsyncData->Queue.TryPush(this, msg))
+				s_AsyncData->Pushed.fetch_add(1, std::memory_order_release);
+			else
+				m_Dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		//	The flusher flushes after every batch, Log::Flush() waits for it
+		void flush() override {}
+
+		void set_pattern(const std::string& pattern) override
+		{
+			for (spdlog::sink_ptr& sink : m_Sinks)
+				sink->set_pattern(pattern);
+		}
+
+		void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override
+		{
+			for (spdlog::sink_ptr& sink : m_Sinks)
+				sink->set_formatter(formatter->clone());
+		}
+
+		//	Flusher thread only
+		void Write(const LogRecord& record)
+		{
+			spdlog::details::log_msg msg(record.Time, spdlog::source_loc{}, spdlog::string_view_t(record.Name, record.NameLength),
+				record.Level, spdlog::string_view_t(record.Payload, record.PayloadLength));
+			msg.thread_id = record.ThreadID;
+			WriteToSinks(msg);
+		}
+
+		//	Flusher thread only
+		void FlushSinks()
+		{
+			ReportDropped();
+			if (!m_Dirty)
+				return;
+
+			for (spdlog::sink_ptr& sink : m_Sinks)
+				sink->flush();
+			m_Dirty = false;
+		}
+
+		uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+	private:
+		void WriteToSinks(const spdlog::details::log_msg& msg)
+		{
+			for (spdlog::sink_ptr& sink : m_Sinks)
+			{
+				if (sink->should_log(msg.level))
+					sink->log(msg);
+			}
+			m_Dirty = true;
+		}
+
+		void ReportDropped()
+		{
+			const uint64_t dropped = m_Dropped.load(std::memory_order_relaxed);
+			if (dropped == m_ReportedDropped)
+				return;
+
+			const std::string text = fmt::format("Log queue full, dropped {0} messages", dropped - m_ReportedDropped);
+			WriteToSinks(spdlog::details::log_msg(spdlog::string_view_t("Log"), spdlog::level::warn, text));
+			m_ReportedDropped = dropped;
+		}
+	private:
+		std::vector<spdlog::sink_ptr> m_Sinks;
+		std::atomic<uint64_t> m_Dropped = 0;
+		uint64_t m_ReportedDropped = 0;
+		bool m_Dirty = false;
+	};
 
+	static void AsyncLogFlusher()
+	{
+		#if defined(RP_PLATFORM_WINDOWS)
+			SetThreadDescription(GetCurrentThread(), L"RAPIER Log Thread");
+		#endif
+
+		for (;;)
+		{
+			//	Read before draining, so nothing pushed before Shutdown() is left behind
+			const bool running = s_AsyncData->Running.load(std::memory_order_acquire);
+
+			uint64_t written = 0;
+			while (s_AsyncData->Queue.TryPop([](LogRecord& record) { record.Target->Write(record); }))
+				written++;
+
+			for (const std::shared_ptr<AsyncLogSink>& sink : s_AsyncData->Sinks)
+				sink->FlushSinks();
+			s_AsyncData->Written.fetch_add(written, std::memory_order_release);
+
+			if (!running)
+				break;
+			if (written == 0)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	//  -----------------------------  LOG  -----------------------------  //
 	std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 	std::shared_ptr<spdlog::logger> Log::s_EditorConsoleLogger;
 	std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
-	void Log::Init()
+	void Log::Init(bool async)
 	{
 		// Create logs directory
 		std::string logsDirectory = "logs";
@@ -50,28 +212,73 @@ namespace RAPIER
 		appSinks[1]->set_pattern("[%T] [%l] %n: %v");
 		appSinks[2]->set_pattern("%^[%T] %n: %v%$");
 
+		if (async)
+		{
+			s_AsyncData = new AsyncLogData();
+			for (std::vector<spdlog::sink_ptr>* sinks : { &rapierSinks, &editorConsoleSinks, &appSinks })
+			{
+				std::shared_ptr<AsyncLogSink> asyncSink = std::make_shared<AsyncLogSink>(std::move(*sinks));
+				s_AsyncData->Sinks.push_back(asyncSink);
+				*sinks = { asyncSink };
+			}
+			s_AsyncData->Flusher = std::thread(AsyncLogFlusher);
+		}
+
+		//	Async loggers never flush on their own, whoever needs the output out now calls Log::Flush()
+		const spdlog::level::level_enum flushLevel = async ? spdlog::level::off : spdlog::level::trace;
+
 		s_CoreLogger = std::make_shared<spdlog::logger>("RAPIER", rapierSinks.begin(), rapierSinks.end());
 		spdlog::register_logger(s_CoreLogger);
 		s_CoreLogger->set_level(spdlog::level::trace);
-		s_CoreLogger->flush_on(spdlog::level::trace);
+		s_CoreLogger->flush_on(flushLevel);
 
 		s_EditorConsoleLogger = std::make_shared<spdlog::logger>("Console", editorConsoleSinks.begin(), editorConsoleSinks.end());
 		spdlog::register_logger(s_EditorConsoleLogger);
 		s_EditorConsoleLogger->set_level(spdlog::level::trace);
-		s_EditorConsoleLogger->flush_on(spdlog::level::trace);
+		s_EditorConsoleLogger->flush_on(flushLevel);
 
 		s_ClientLogger = std::make_shared<spdlog::logger>("APP", appSinks.begin(), appSinks.end());
 		spdlog::register_logger(s_ClientLogger);
 		s_ClientLogger->set_level(spdlog::level::trace);
-		s_ClientLogger->flush_on(spdlog::level::trace);
+		s_ClientLogger->flush_on(flushLevel);
+	}
+
+	void Log::Flush()
+	{
+		if (!s_AsyncData)
+			return;
+
+		const uint64_t target = s_AsyncData->Pushed.load(std::memory_order_acquire);
+		while (s_AsyncData->Written.load(std::memory_order_acquire) < target)
+			std::this_thread::yield();
+	}
+
+	uint64_t Log::GetDroppedMessageCount()
+	{
+		if (!s_AsyncData)
+			return 0;
+
+		uint64_t dropped = 0;
+		for (const std::shared_ptr<AsyncLogSink>& sink : s_AsyncData->Sinks)
+			dropped += sink->GetDroppedCount();
+		return dropped;
 	}
 
 	void Log::Shutdown()
 	{
+		//	Loggers go first so nothing can reach the queue once the flusher has drained it
 		s_CoreLogger.reset();
 		s_EditorConsoleLogger.reset();
 		s_ClientLogger.reset();
 		spdlog::drop_all();
+
+		if (s_AsyncData)
+		{
+			s_AsyncData->Running.store(false, std::memory_order_release);
+			s_AsyncData->Flusher.join();
+			delete s_AsyncData;
+			s_AsyncData = nullptr;
+		}
 	}
 
 }	//	END namespace RAPIER
@@ -2,6 +2,9 @@
 
 #include "RAPIER/Core/Base.h"
 
+#include <atomic>
+#include <chrono>
+
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
 
@@ -16,9 +19,16 @@ namespace RAPIER
 	class Log
 	{
 	public:
-		static void Init();
+		//	Async hands formatted messages to a background thread through a lock free queue, so logging
+		//	never waits on the console or a file. Messages are dropped and counted while the queue is full.
+		static void Init(bool async = true);
 		static void Shutdown();
 
+		//	Blocks until everything logged so far has reached the sinks, no-op when synchronous.
+		//	Asserts call it before breaking, nothing else flushes on its own.
+		static void Flush();
+		static uint64_t GetDroppedMessageCount();
+
 		static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
 		static std::shared_ptr<spdlog::logger>& GetEditorConsoleLogger() { return s_EditorConsoleLogger; }
 		static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
@@ -27,6 +37,26 @@ namespace RAPIER
 		static std::shared_ptr<spdlog::logger> s_EditorConsoleLogger;
 		static std::shared_ptr<spdlog::logger> s_ClientLogger;
 	};
+
+	//	Lets one message through per interval, shared by every thread hitting the same call site
+	class LogRateLimiter
+	{
+	public:
+		explicit LogRateLimiter(int64_t intervalMs)
+			: m_IntervalMs(intervalMs) {}
+
+		bool Allow()
+		{
+			const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			int64_t next = m_NextAllowed.load(std::memory_order_relaxed);
+			if (now < next)
+				return false;
+			return m_NextAllowed.compare_exchange_strong(next, now + m_IntervalMs, std::memory_order_relaxed);
+		}
+	private:
+		int64_t m_IntervalMs;
+		std::atomic<int64_t> m_NextAllowed = 0;
+	};
 }	//	END namespace RAPIER
 
 template<typename OStream, glm::length_t L, typename T, glm::qualifier Q>
@@ -65,74 +95,118 @@ inline OStream& operator<<(OStream& os, glm::qua<T, Q> quaternion)
 	return os << glm::to_string(quaternion);
 }
 
-#ifdef RP_DEBUG	//	DEBUG
-	// Core Log Defines
-	#define RP_CORE_TRACE(...)		::RAPIER::Log::GetCoreLogger()->trace(__VA_ARGS__)
-	#define RP_CORE_INFO(...)		::RAPIER::Log::GetCoreLogger()->info(__VA_ARGS__)
-	#define RP_CORE_WARN(...)		::RAPIER::Log::GetCoreLogger()->warn(__VA_ARGS__)
-	#define RP_CORE_ERROR(...)		::RAPIER::Log::GetCoreLogger()->error(__VA_ARGS__)
-	#define RP_CORE_CRITICAL(...)	::RAPIER::Log::GetCoreLogger()->critical(__VA_ARGS__)
+//	Messages below RP_LOG_LEVEL compile to nothing, arguments included. Defaults to everything in
+//	Debug and info and up otherwise, define it in the project to override
+#define RP_LOG_LEVEL_TRACE		0
+#define RP_LOG_LEVEL_INFO		1
+#define RP_LOG_LEVEL_WARN		2
+#define RP_LOG_LEVEL_ERROR		3
+#define RP_LOG_LEVEL_CRITICAL	4
+#define RP_LOG_LEVEL_OFF		5
+
+#ifndef RP_LOG_LEVEL
+	#ifdef RP_DEBUG
+		#define RP_LOG_LEVEL RP_LOG_LEVEL_TRACE
+	#else
+		#define RP_LOG_LEVEL RP_LOG_LEVEL_INFO
+	#endif
+#endif
 
-	//	Editor Console Log defines
-	#define RP_CONSOLE_TRACE(...)			::RAPIER::Log::GetEditorConsoleLogger()->trace(__VA_ARGS__)
-	#define RP_CONSOLE_INFO(...)			::RAPIER::Log::GetEditorConsoleLogger()->info(__VA_ARGS__)
-	#define RP_CONSOLE_WARN(...)			::RAPIER::Log::GetEditorConsoleLogger()->warn(__VA_ARGS__)
-	#define RP_CONSOLE_ERROR(...)			::RAPIER::Log::GetEditorConsoleLogger()->error(__VA_ARGS__)
-	#define RP_CONSOLE_CRITICAL(...)		::RAPIER::Log::GetEditorConsoleLogger()->critical(__VA_ARGS__)
+#define RP_LOG_DISCARD(...)		((void)0)
 
-	//	Client Log Defines
-	#define RP_TRACE(...)			::RAPIER::Log::GetClientLogger()->trace(__VA_ARGS__)
-	#define RP_INFO(...)			::RAPIER::Log::GetClientLogger()->info(__VA_ARGS__)
-	#define RP_WARN(...)			::RAPIER::Log::GetClientLogger()->warn(__VA_ARGS__)
-	#define RP_ERROR(...)			::RAPIER::Log::GetClientLogger()->error(__VA_ARGS__)
-	#define RP_CRITICAL(...)		::RAPIER::Log::GetClientLogger()->critical(__VA_ARGS__)
+#if RP_LOG_LEVEL <= RP_LOG_LEVEL_TRACE
+	#define RP_LOG_TRACE_IMPL(logger, ...)		(logger)->trace(__VA_ARGS__)
+#else
+	#define RP_LOG_TRACE_IMPL(logger, ...)		RP_LOG_DISCARD()
+#endif
+#if RP_LOG_LEVEL <= RP_LOG_LEVEL_INFO
+	#define RP_LOG_INFO_IMPL(logger, ...)		(logger)->info(__VA_ARGS__)
+#else
+	#define RP_LOG_INFO_IMPL(logger, ...)		RP_LOG_DISCARD()
+#endif
+#if RP_LOG_LEVEL <= RP_LOG_LEVEL_WARN
+	#define RP_LOG_WARN_IMPL(logger, ...)		(logger)->warn(__VA_ARGS__)
+#else
+	#define RP_LOG_WARN_IMPL(logger, ...)		RP_LOG_DISCARD()
+#endif
+#if RP_LOG_LEVEL <= RP_LOG_LEVEL_ERROR
+	#define RP_LOG_ERROR_IMPL(logger, ...)		(logger)->error(__VA_ARGS__)
+#else
+	#define RP_LOG_ERROR_IMPL(logger, ...)		RP_LOG_DISCARD()
+#endif
+#if RP_LOG_LEVEL <= RP_LOG_LEVEL_CRITICAL
+	#define RP_LOG_CRITICAL_IMPL(logger, ...)	(logger)->critical(__VA_ARGS__)
+#else
+	#define RP_LOG_CRITICAL_IMPL(logger, ...)	RP_LOG_DISCARD()
+#endif
 
+//	Which loggers exist in each configuration
+#if defined(RP_DEBUG)
+	#define RP_LOG_CORE_ENABLED		1
+	#define RP_LOG_CONSOLE_ENABLED	1
+	#define RP_LOG_CLIENT_ENABLED	1
+#elif defined(RP_RELEASE)
+	#define RP_LOG_CORE_ENABLED		0	//	Don't Log Engine Messages
+	#define RP_LOG_CONSOLE_ENABLED	1
+	#define RP_LOG_CLIENT_ENABLED	1
+#elif defined(RP_DISTRIBUTION)
+	#define RP_LOG_CORE_ENABLED		0	//	Don't Log Engine Messages
+	#define RP_LOG_CONSOLE_ENABLED	0	//	Don't Log Editor Console Messages
+	#define RP_LOG_CLIENT_ENABLED	0	//	Don't Log Client Messages
 #endif
 
-#ifdef RP_RELEASE	//	RFELEASE
-	//	Don't Log Engine Messages
-	#define RP_CORE_TRACE
-	#define RP_CORE_INFO
-	#define RP_CORE_WARN
-	#define RP_CORE_ERROR
-	#define RP_CORE_CRITICAL
+#if RP_LOG_CORE_ENABLED
+	// Core Log Defines
+	#define RP_CORE_TRACE(...)		RP_LOG_TRACE_IMPL(::RAPIER::Log::GetCoreLogger(), __VA_ARGS__)
+	#define RP_CORE_INFO(...)		RP_LOG_INFO_IMPL(::RAPIER::Log::GetCoreLogger(), __VA_ARGS__)
+	#define RP_CORE_WARN(...)		RP_LOG_WARN_IMPL(::RAPIER::Log::GetCoreLogger(), __VA_ARGS__)
+	#define RP_CORE_ERROR(...)		RP_LOG_ERROR_IMPL(::RAPIER::Log::GetCoreLogger(), __VA_ARGS__)
+	#define RP_CORE_CRITICAL(...)	RP_LOG_CRITICAL_IMPL(::RAPIER::Log::GetCoreLogger(), __VA_ARGS__)
+#else
+	#define RP_CORE_TRACE(...)		RP_LOG_DISCARD()
+	#define RP_CORE_INFO(...)		RP_LOG_DISCARD()
+	#define RP_CORE_WARN(...)		RP_LOG_DISCARD()
+	#define RP_CORE_ERROR(...)		RP_LOG_DISCARD()
+	#define RP_CORE_CRITICAL(...)	RP_LOG_DISCARD()
+#endif
 
+#if RP_LOG_CONSOLE_ENABLED
 	//	Editor Console Log defines
-	#define RP_CONSOLE_TRACE(...)			::RAPIER::Log::GetEditorConsoleLogger()->trace(__VA_ARGS__)
-	#define RP_CONSOLE_INFO(...)			::RAPIER::Log::GetEditorConsoleLogger()->info(__VA_ARGS__)
-	#define RP_CONSOLE_WARN(...)			::RAPIER::Log::GetEditorConsoleLogger()->warn(__VA_ARGS__)
-	#define RP_CONSOLE_ERROR(...)			::RAPIER::Log::GetEditorConsoleLogger()->error(__VA_ARGS__)
-	#define RP_CONSOLE_CRITICAL(...)		::RAPIER::Log::GetEditorConsoleLogger()->critical(__VA_ARGS__)
-
-	//	Client Log Defines
-	#define RP_TRACE(...)			::RAPIER::Log::GetClientLogger()->trace(__VA_ARGS__)
-	#define RP_INFO(...)			::RAPIER::Log::GetClientLogger()->info(__VA_ARGS__)
-	#define RP_WARN(...)			::RAPIER::Log::GetClientLogger()->warn(__VA_ARGS__)
-	#define RP_ERROR(...)			::RAPIER::Log::GetClientLogger()->error(__VA_ARGS__)
-	#define RP_CRITICAL(...)		::RAPIER::Log::GetClientLogger()->critical(__VA_ARGS__)
+	#define RP_CONSOLE_TRACE(...)			RP_LOG_TRACE_IMPL(::RAPIER::Log::GetEditorConsoleLogger(), __VA_ARGS__)
+	#define RP_CONSOLE_INFO(...)			RP_LOG_INFO_IMPL(::RAPIER::Log::GetEditorConsoleLogger(), __VA_ARGS__)
+	#define RP_CONSOLE_WARN(...)			RP_LOG_WARN_IMPL(::RAPIER::Log::GetEditorConsoleLogger(), __VA_ARGS__)
+	#define RP_CONSOLE_ERROR(...)			RP_LOG_ERROR_IMPL(::RAPIER::Log::GetEditorConsoleLogger(), __VA_ARGS__)
+	#define RP_CONSOLE_CRITICAL(...)		RP_LOG_CRITICAL_IMPL(::RAPIER::Log::GetEditorConsoleLogger(), __VA_ARGS__)
+#else
+	#define RP_CONSOLE_TRACE(...)			RP_LOG_DISCARD()
+	#define RP_CONSOLE_INFO(...)			RP_LOG_DISCARD()
+	#define RP_CONSOLE_WARN(...)			RP_LOG_DISCARD()
+	#define RP_CONSOLE_ERROR(...)			RP_LOG_DISCARD()
+	#define RP_CONSOLE_CRITICAL(...)		RP_LOG_DISCARD()
 #endif
 
-#ifdef RP_DISTRIBUTION	//	DISTRIBUTION
-	//	Don't Log Engine Messages
-	#define RP_CORE_TRACE
-	#define RP_CORE_INFO
-	#define RP_CORE_WARN
-	#define RP_CORE_ERROR
-	#define RP_CORE_CRITICAL
-	//	Don't Log Editor Console Messages
-	#define RP_CONSOLE_TRACE(...)
-	#define RP_CONSOLE_INFO(...)
-	#define RP_CONSOLE_WARN(...)
-	#define RP_CONSOLE_ERROR(...)
-	#define RP_CONSOLE_CRITICAL(...)
-	//	Don't Log Client Messages
-	#define RP_TRACE
-	#define RP_INFO
-	#define RP_WARN
-	#define RP_ERROR
-	#define RP_CRITICAL
+#if RP_LOG_CLIENT_ENABLED
+	//	Client Log Defines
+	#define RP_TRACE(...)			RP_LOG_TRACE_IMPL(::RAPIER::Log::GetClientLogger(), __VA_ARGS__)
+	#define RP_INFO(...)			RP_LOG_INFO_IMPL(::RAPIER::Log::GetClientLogger(), __VA_ARGS__)
+	#define RP_WARN(...)			RP_LOG_WARN_IMPL(::RAPIER::Log::GetClientLogger(), __VA_ARGS__)
+	#define RP_ERROR(...)			RP_LOG_ERROR_IMPL(::RAPIER::Log::GetClientLogger(), __VA_ARGS__)
+	#define RP_CRITICAL(...)		RP_LOG_CRITICAL_IMPL(::RAPIER::Log::GetClientLogger(), __VA_ARGS__)
+#else
+	#define RP_TRACE(...)			RP_LOG_DISCARD()
+	#define RP_INFO(...)			RP_LOG_DISCARD()
+	#define RP_WARN(...)			RP_LOG_DISCARD()
+	#define RP_ERROR(...)			RP_LOG_DISCARD()
+	#define RP_CRITICAL(...)		RP_LOG_DISCARD()
 #endif	//	END LOGGING DEFINES
 
+//	Rate limited logging for anything that can fire every frame or per item, limits are per call site:
+//	RP_LOG_EVERY_MS(1000, RP_CORE_WARN, "Pool is full ({0})", count);
+#define RP_LOG_EVERY_MS(intervalMs, LOG_MACRO, ...) \
+	do { static ::RAPIER::LogRateLimiter rp_logRateLimiter_(intervalMs); if (rp_logRateLimiter_.Allow()) { LOG_MACRO(__VA_ARGS__); } } while (0)
+#define RP_LOG_ONCE(LOG_MACRO, ...) \
+	do { static std::atomic<bool> rp_logOnce_ = false; if (!rp_logOnce_.exchange(true, std::memory_order_relaxed)) { LOG_MACRO(__VA_ARGS__); } } while (0)
+
 #if !(defined RP_DEBUG || defined RP_RELEASE || defined RP_DISTRIBUTION)
 	#error No configuration provided, please define RP_DEBUG, RP_RELEASE, or RP_DISTRIBUTION
 #endif
@@ -0,0 +1,206 @@
+#include "rppch.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace RAPIER
+{
+	namespace
+	{
+		struct TagCounters
+		{
+			std::atomic<uint64_t> AllocationCount = 0;
+			std::atomic<uint64_t> FreeCount = 0;
+			std::atomic<uint64_t> AllocatedBytes = 0;
+			std::atomic<uint64_t> FreedBytes = 0;
+		};
+
+		//	Plain globals, these have to be usable before any static constructor runs
+		TagCounters s_TagCounters[(size_t)MemoryTag::Count];
+		std::atomic<uint64_t> s_FrameCount = 0;
+		std::atomic<uint64_t> s_FrameBytes = 0;
+		FrameAllocationStats s_LastFrameStats;
+
+		thread_local MemoryTag s_ThreadTag = MemoryTag::Default;
+	}
+
+	const char* MemoryTagToString(MemoryTag tag)
+	{
+		switch (tag)
+		{
+			case MemoryTag::Default:	return "Default";
+			case MemoryTag::Renderer:	return "Renderer";
+			case MemoryTag::Scene:		return "Scene";
+			case MemoryTag::Assets:		return "Assets";
+			case MemoryTag::Audio:		return "Audio";
+			case MemoryTag::Script:		return "Script";
+		}
+		return "Unknown";
+	}
+
+	MemoryTag AllocationTracker::GetThreadTag()
+	{
+		return s_ThreadTag;
+	}
+
+	void AllocationTracker::SetThreadTag(MemoryTag tag)
+	{
+		s_ThreadTag = tag;
+	}
+
+	AllocationStats AllocationTracker::GetStats(MemoryTag tag)
+	{
+		const TagCounters& counters = s_TagCounters[(size_t)tag];
+
+		AllocationStats stats;
+		stats.AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed);
+		stats.FreeCount = counters.FreeCount.load(std::memory_order_relaxed);
+		stats.AllocatedBytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+		stats.FreedBytes = counters.FreedBytes.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	AllocationStats AllocationTracker::GetTotalStats()
+	{
+		AllocationStats total;
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			AllocationStats stats = GetStats((MemoryTag)i);
+			total.AllocationCount += stats.AllocationCount;
+			total.FreeCount += stats.FreeCount;
+			total.AllocatedBytes += stats.AllocatedBytes;
+			total.FreedBytes += stats.FreedBytes;
+		}
+		return total;
+	}
+
+	FrameAllocationStats AllocationTracker::GetLastFrameStats()
+	{
+		return s_LastFrameStats;
+	}
+
+	void AllocationTracker::EndFrame()
+	{
+		s_LastFrameStats.Count = s_FrameCount.exchange(0, std::memory_order_relaxed);
+		s_LastFrameStats.Bytes = s_FrameBytes.exchange(0, std::memory_order_relaxed);
+	}
+
+	std::string AllocationTracker::DumpJSON()
+	{
+		std::stringstream ss;
+		ss << "{\n";
+		ss << "\t\"enabled\": " << (IsEnabled() ? "true" : "false") << ",\n";
+		ss << "\t\"frame\": { \"count\": " << s_LastFrameStats.Count << ", \"bytes\": " << s_LastFrameStats.Bytes << " },\n";
+		ss << "\t\"tags\": {\n";
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			AllocationStats stats = GetStats((MemoryTag)i);
+			ss << "\t\t\"" << MemoryTagToString((MemoryTag)i) << "\": { "
+				<< "\"currentBytes\": " << stats.GetCurrentUsage() << ", "
+				<< "\"liveAllocations\": " << stats.GetLiveAllocations() << ", "
+				<< "\"allocatedBytes\": " << stats.AllocatedBytes << ", "
+				<< "\"allocationCount\": " << stats.AllocationCount << " }"
+				<< (i + 1 < (size_t)MemoryTag::Count ? ",\n" : "\n");
+		}
+		ss << "\t}\n";
+		ss << "}\n";
+		return ss.str();
+	}
+
+	bool AllocationTracker::WriteJSON(const std::string& filepath)
+	{
+		std::ofstream out(filepath);
+		if (!out)
+		{
+			RP_CORE_ERROR("AllocationTracker - Could not open {0} for writing", filepath);
+			return false;
+		}
+
+		out << DumpJSON();
+		return true;
+	}
+
+	void AllocationTracker::RecordAllocation(size_t size, MemoryTag tag)
+	{
+		TagCounters& counters = s_TagCounters[(size_t)tag];
+		counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		counters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+		s_FrameCount.fetch_add(1, std::memory_order_relaxed);
+		s_FrameBytes.fetch_add(size, std::memory_order_relaxed);
+	}
+
+	void AllocationTracker::RecordFree(size_t size, MemoryTag tag)
+	{
+		TagCounters& counters = s_TagCounters[(size_t)tag];
+		counters.FreeCount.fetch_add(1, std::memory_order_relaxed);
+		counters.FreedBytes.fetch_add(size, std::memory_order_relaxed);
+	}
+
+}	//	END namespace RAPIER
+
+#if RP_ENABLE_MEMORY_TRACKING
+
+//  -----------------------------  GLOBAL ALLOCATION HOOK  -----------------------------  //
+//	Every allocation is prefixed with a header holding its size and tag, so frees are
+//	attributed to the subsystem that made the allocation. Over-aligned new/delete are
+//	left to the default implementation.
+namespace
+{
+	struct alignas(16) AllocationHeader
+	{
+		size_t Size;
+		RAPIER::MemoryTag Tag;
+	};
+	static_assert(sizeof(AllocationHeader) == 16, "Header must keep the default new alignment");
+
+	void* TrackedAllocate(size_t size)
+	{
+		AllocationHeader* header = static_cast<AllocationHeader*>(std::malloc(size + sizeof(AllocationHeader)));
+		if (!header)
+			return nullptr;
+
+		header->Size = size;
+		header->Tag = RAPIER::AllocationTracker::GetThreadTag();
+		RAPIER::AllocationTracker::RecordAllocation(size, header->Tag);
+		return header + 1;
+	}
+
+	void TrackedFree(void* memory)
+	{
+		if (!memory)
+			return;
+
+		AllocationHeader* header = static_cast<AllocationHeader*>(memory) - 1;
+		RAPIER::AllocationTracker::RecordFree(header->Size, header->Tag);
+		std::free(header);
+	}
+}
+
+void* operator new(size_t size)
+{
+	if (void* memory = TrackedAllocate(size))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	if (void* memory = TrackedAllocate(size))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size); }
+
+void operator delete(void* memory) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, size_t) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+
+#endif
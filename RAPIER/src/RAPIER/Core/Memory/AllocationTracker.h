@@ -0,0 +1,93 @@
+#pragma once
+
+#include "RAPIER/Core/CoreConfig.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace RAPIER
+{
+	//	Subsystem an allocation is attributed to, set per thread with RP_MEMORY_TAG
+	enum class MemoryTag : uint8_t
+	{
+		Default = 0,
+		Renderer,
+		Scene,
+		Assets,
+		Audio,
+		Script,
+
+		Count
+	};
+
+	const char* MemoryTagToString(MemoryTag tag);
+
+	struct AllocationStats
+	{
+		uint64_t AllocationCount = 0;
+		uint64_t FreeCount = 0;
+		uint64_t AllocatedBytes = 0;
+		uint64_t FreedBytes = 0;
+
+		uint64_t GetCurrentUsage() const { return AllocatedBytes - FreedBytes; }
+		uint64_t GetLiveAllocations() const { return AllocationCount - FreeCount; }
+	};
+
+	struct FrameAllocationStats
+	{
+		uint64_t Count = 0;
+		uint64_t Bytes = 0;
+	};
+
+	//	Global operator new/delete hook, compiled in with RP_ENABLE_MEMORY_TRACKING (see CoreConfig.h).
+	//	Without it every query returns zeroes.
+	class AllocationTracker
+	{
+	public:
+		static constexpr bool IsEnabled()
+		{
+		#if RP_ENABLE_MEMORY_TRACKING
+			return true;
+		#else
+			return false;
+		#endif
+		}
+
+		static MemoryTag GetThreadTag();
+		static void SetThreadTag(MemoryTag tag);
+
+		static AllocationStats GetStats(MemoryTag tag);
+		static AllocationStats GetTotalStats();
+
+		//	Allocations made during the last completed frame, all threads combined
+		static FrameAllocationStats GetLastFrameStats();
+		static void EndFrame();	//	Called by the Application once per frame
+
+		static std::string DumpJSON();
+		static bool WriteJSON(const std::string& filepath);
+
+		static void RecordAllocation(size_t size, MemoryTag tag);
+		static void RecordFree(size_t size, MemoryTag tag);
+	};
+
+	class MemoryTagScope
+	{
+	public:
+		MemoryTagScope(MemoryTag tag)
+			: m_PreviousTag(AllocationTracker::GetThreadTag())
+		{
+			AllocationTracker::SetThreadTag(tag);
+		}
+		~MemoryTagScope() { AllocationTracker::SetThreadTag(m_PreviousTag); }
+	private:
+		MemoryTag m_PreviousTag;
+	};
+
+}	//	END namespace RAPIER
+
+#if RP_ENABLE_MEMORY_TRACKING
+	#define RP_MEMORY_TAG(tag) ::RAPIER::MemoryTagScope RP_CONCAT(rp_memoryTagScope_, __LINE__)(::RAPIER::MemoryTag::tag)
+#else
+	#define RP_MEMORY_TAG(tag)
+#endif
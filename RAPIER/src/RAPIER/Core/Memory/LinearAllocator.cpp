@@ -0,0 +1,72 @@
+#include "rppch.h"
+#include "RAPIER/Core/Memory/LinearAllocator.h"
+
+namespace RAPIER
+{
+	static size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	LinearAllocator::LinearAllocator(size_t capacity)
+		: m_Capacity(capacity)
+	{
+		m_Base = static_cast<std::byte*>(::operator new(m_Capacity, std::align_val_t(alignof(std::max_align_t))));
+	}
+
+	LinearAllocator::~LinearAllocator()
+	{
+		Reset();
+		::operator delete(m_Base, std::align_val_t(alignof(std::max_align_t)));
+	}
+
+	void* LinearAllocator::Allocate(size_t size, size_t alignment)
+	{
+		RP_CORE_ASSERT((alignment & (alignment - 1)) == 0, "Alignment must be a power of two!");
+
+		const size_t offset = AlignUp(m_Offset, alignment);
+		if (offset + size <= m_Capacity)
+		{
+			m_Offset = offset + size;
+			if (m_Offset + m_OverflowBytes > m_HighWater)
+				m_HighWater = m_Offset + m_OverflowBytes;
+			return m_Base + offset;
+		}
+
+		//	Out of space, keep going on the heap and grow on the next Reset()
+		alignment = alignment < alignof(std::max_align_t) ? alignof(std::max_align_t) : alignment;
+		void* memory = ::operator new(size, std::align_val_t(alignment));
+		m_Overflow.push_back({ memory, alignment });
+		m_OverflowBytes += size;
+		if (m_Offset + m_OverflowBytes > m_HighWater)
+			m_HighWater = m_Offset + m_OverflowBytes;
+		return memory;
+	}
+
+	void LinearAllocator::Rewind(size_t marker)
+	{
+		RP_CORE_ASSERT(marker <= m_Offset, "Invalid marker!");
+		m_Offset = marker;
+	}
+
+	void LinearAllocator::Reset()
+	{
+		if (!m_Overflow.empty())
+		{
+			for (auto& [memory, alignment] : m_Overflow)
+				::operator delete(memory, std::align_val_t(alignment));
+			m_Overflow.clear();
+			m_OverflowBytes = 0;
+
+			if (m_HighWater > m_Capacity)
+			{
+				::operator delete(m_Base, std::align_val_t(alignof(std::max_align_t)));
+				m_Capacity = AlignUp(m_HighWater + m_HighWater / 2, alignof(std::max_align_t));
+				m_Base = static_cast<std::byte*>(::operator new(m_Capacity, std::align_val_t(alignof(std::max_align_t))));
+			}
+		}
+
+		m_Offset = 0;
+	}
+
+}	//	END namespace RAPIER
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace RAPIER
+{
+	//	Bump allocator over a single block. Individual allocations are never freed, the whole
+	//	allocator is reset (or rewound to a marker) at once. Destructors are NOT called, only
+	//	place trivially destructible data in here or destroy objects manually.
+	//
+	//	When the block runs out, allocations fall back to the heap and Reset() grows the block
+	//	to the high water mark, so steady-state use does not touch the heap.
+	//	Not thread-safe, use one allocator per thread (see Memory::GetScratchAllocator).
+	class LinearAllocator
+	{
+	public:
+		explicit LinearAllocator(size_t capacity);
+		~LinearAllocator();
+
+		LinearAllocator(const LinearAllocator&) = delete;
+		LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		T* AllocateArray(size_t count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		template<typename T, typename... Args>
+		T* New(Args&&... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		//	Markers only cover the main block, overflow allocations are kept until Reset()
+		size_t GetMarker() const { return m_Offset; }
+		void Rewind(size_t marker);
+		void Reset();
+
+		size_t GetCapacity() const { return m_Capacity; }
+		size_t GetUsed() const { return m_Offset + m_OverflowBytes; }
+		size_t GetHighWater() const { return m_HighWater; }
+	private:
+		std::byte* m_Base = nullptr;
+		size_t m_Capacity = 0;
+		size_t m_Offset = 0;
+		size_t m_HighWater = 0;
+
+		std::vector<std::pair<void*, size_t>> m_Overflow;	//	Memory, alignment
+		size_t m_OverflowBytes = 0;
+	};
+
+}	//	END namespace RAPIER
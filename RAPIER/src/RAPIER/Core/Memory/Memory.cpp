@@ -0,0 +1,40 @@
+#include "rppch.h"
+#include "RAPIER/Core/Memory/Memory.h"
+
+namespace RAPIER
+{
+	static constexpr size_t FrameAllocatorSize = 4 * 1024 * 1024;	//	4 MB, grows to the high water mark
+	static constexpr size_t ScratchAllocatorSize = 1024 * 1024;		//	1 MB per thread
+
+	static LinearAllocator* s_FrameAllocator = nullptr;
+
+	void Memory::Init()
+	{
+		RP_CORE_ASSERT(!s_FrameAllocator, "Memory already initialized!");
+		s_FrameAllocator = new LinearAllocator(FrameAllocatorSize);
+	}
+
+	void Memory::Shutdown()
+	{
+		delete s_FrameAllocator;
+		s_FrameAllocator = nullptr;
+	}
+
+	void Memory::BeginFrame()
+	{
+		s_FrameAllocator->Reset();
+	}
+
+	LinearAllocator& Memory::GetFrameAllocator()
+	{
+		RP_CORE_ASSERT(s_FrameAllocator, "Memory not initialized!");
+		return *s_FrameAllocator;
+	}
+
+	LinearAllocator& Memory::GetScratchAllocator()
+	{
+		thread_local LinearAllocator s_ScratchAllocator(ScratchAllocatorSize);
+		return s_ScratchAllocator;
+	}
+
+}	//	END namespace RAPIER
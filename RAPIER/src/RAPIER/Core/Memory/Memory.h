@@ -0,0 +1,60 @@
+#pragma once
+
+#include "RAPIER/Core/Memory/LinearAllocator.h"
+#include "RAPIER/Core/Memory/PoolAllocator.h"
+
+namespace RAPIER
+{
+	class Memory
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		//	Called by the Application at the start of every frame
+		static void BeginFrame();
+
+		//	Main thread only. Everything allocated here is released at the start of the next frame.
+		static LinearAllocator& GetFrameAllocator();
+
+		//	Per-thread arena for short-lived temporaries, use through ScratchScope
+		static LinearAllocator& GetScratchAllocator();
+	};
+
+	//	Rewinds the calling thread's scratch arena when it goes out of scope. The outermost scope
+	//	resets it instead, which also frees whatever overflowed onto the heap.
+	//		ScratchScope scratch;
+	//		float* samples = scratch.AllocateArray<float>(count);
+	class ScratchScope
+	{
+	public:
+		ScratchScope()
+			: m_Allocator(Memory::GetScratchAllocator()), m_Marker(m_Allocator.GetMarker())
+		{
+			s_Depth++;
+		}
+		~ScratchScope()
+		{
+			if (--s_Depth == 0)
+				m_Allocator.Reset();
+			else
+				m_Allocator.Rewind(m_Marker);
+		}
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) { return m_Allocator.Allocate(size, alignment); }
+
+		template<typename T>
+		T* AllocateArray(size_t count) { return m_Allocator.AllocateArray<T>(count); }
+
+		LinearAllocator& GetAllocator() { return m_Allocator; }
+	private:
+		LinearAllocator& m_Allocator;
+		size_t m_Marker;
+
+		inline static thread_local uint32_t s_Depth = 0;
+	};
+
+}	//	END namespace RAPIER
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace RAPIER
+{
+	//	Fixed-size block allocator for small, frequently created objects. Blocks are carved out
+	//	of chunks that are never returned to the heap until the pool is destroyed, freed blocks
+	//	go on an intrusive free list. Allocate/Free are guarded by a spin lock, so blocks can be
+	//	allocated on one thread and freed on another (e.g. game thread -> audio thread).
+	template<size_t BlockSize, size_t BlockAlignment = alignof(std::max_align_t), size_t BlocksPerChunk = 256>
+	class PoolAllocator
+	{
+		static_assert((BlockAlignment & (BlockAlignment - 1)) == 0, "Alignment must be a power of two!");
+	public:
+		PoolAllocator() = default;
+		~PoolAllocator()
+		{
+			for (void* chunk : m_Chunks)
+				::operator delete(chunk, std::align_val_t(BlockAlignment));
+		}
+
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+		void* Allocate()
+		{
+			Lock();
+			if (!m_FreeList)
+				AllocateChunk();
+
+			FreeBlock* block = m_FreeList;
+			m_FreeList = block->Next;
+			m_AllocatedBlocks++;
+			Unlock();
+
+			return block;
+		}
+
+		void Free(void* memory)
+		{
+			if (!memory)
+				return;
+
+			FreeBlock* block = static_cast<FreeBlock*>(memory);
+			Lock();
+			block->Next = m_FreeList;
+			m_FreeList = block;
+			m_AllocatedBlocks--;
+			Unlock();
+		}
+
+		size_t GetAllocatedBlocks() const { return m_AllocatedBlocks; }
+		size_t GetCapacity() const { return m_Chunks.size() * BlocksPerChunk; }
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		static constexpr size_t Stride = ((BlockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : BlockSize) + BlockAlignment - 1) & ~(BlockAlignment - 1);
+
+		void AllocateChunk()
+		{
+			std::byte* chunk = static_cast<std::byte*>(::operator new(Stride * BlocksPerChunk, std::align_val_t(BlockAlignment)));
+			m_Chunks.push_back(chunk);
+
+			for (size_t i = BlocksPerChunk; i > 0; i--)
+			{
+				FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * Stride);
+				block->Next = m_FreeList;
+				m_FreeList = block;
+			}
+		}
+
+		void Lock()
+		{
+			while (m_Lock.test_and_set(std::memory_order_acquire))
+				std::this_thread::yield();
+		}
+		void Unlock() { m_Lock.clear(std::memory_order_release); }
+	private:
+		FreeBlock* m_FreeList = nullptr;
+		std::vector<void*> m_Chunks;
+		size_t m_AllocatedBlocks = 0;
+		std::atomic_flag m_Lock = ATOMIC_FLAG_INIT;
+	};
+
+	//	Typed wrapper, Create/Destroy run the constructor and destructor
+	template<typename T, size_t BlocksPerChunk = 256>
+	class ObjectPool
+	{
+	public:
+		template<typename... Args>
+		T* Create(Args&&... args)
+		{
+			return new (m_Pool.Allocate()) T(std::forward<Args>(args)...);
+		}
+
+		void Destroy(T* object)
+		{
+			if (!object)
+				return;
+
+			object->~T();
+			m_Pool.Free(object);
+		}
+
+		size_t GetAllocatedCount() const { return m_Pool.GetAllocatedBlocks(); }
+	private:
+		PoolAllocator<sizeof(T), alignof(T) < alignof(void*) ? alignof(void*) : alignof(T), BlocksPerChunk> m_Pool;
+	};
+
+}	//	END namespace RAPIER
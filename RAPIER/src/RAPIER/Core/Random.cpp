@@ -0,0 +1,120 @@
+#include "rppch.h"
+#include "Random.h"
+
+#include <atomic>
+#include <random>
+
+namespace RAPIER
+{
+	static inline uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+	//	Spreads any seed, including small or sequential ones, into well mixed state
+	static inline uint64_t SplitMix64(uint64_t& x)
+	{
+		uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	RandomEngine::RandomEngine(uint64_t seed)
+	{
+		for (uint64_t& state : m_State)
+			state = SplitMix64(seed);
+
+		for (uint32_t lane = 0; lane < Lanes; lane++)
+		{
+			const uint64_t a = SplitMix64(seed);
+			const uint64_t b = SplitMix64(seed);
+			m_LaneState[0][lane] = (uint32_t)a;
+			m_LaneState[1][lane] = (uint32_t)(a >> 32);
+			m_LaneState[2][lane] = (uint32_t)b;
+			m_LaneState[3][lane] = (uint32_t)(b >> 32) | 1;	//	Never all zero
+		}
+	}
+
+	uint64_t RandomEngine::UInt64()
+	{
+		const uint64_t result = Rotl(m_State[1] * 5, 7) * 9;
+		const uint64_t t = m_State[1] << 17;
+
+		m_State[2] ^= m_State[0];
+		m_State[3] ^= m_State[1];
+		m_State[1] ^= m_State[2];
+		m_State[0] ^= m_State[3];
+		m_State[2] ^= t;
+		m_State[3] = Rotl(m_State[3], 45);
+
+		return result;
+	}
+
+	void RandomEngine::Fill(float* out, size_t count, float min, float max)
+	{
+		const float scale = (max - min) * (1.0f / 16777216.0f);
+
+		//	Copied out so the compiler knows out doesn't alias the state
+		uint32_t s0[Lanes], s1[Lanes], s2[Lanes], s3[Lanes];
+		for (uint32_t lane = 0; lane < Lanes; lane++)
+		{
+			s0[lane] = m_LaneState[0][lane];
+			s1[lane] = m_LaneState[1][lane];
+			s2[lane] = m_LaneState[2][lane];
+			s3[lane] = m_LaneState[3][lane];
+		}
+
+		size_t i = 0;
+		while (i < count)
+		{
+			float values[Lanes];
+			for (uint32_t lane = 0; lane < Lanes; lane++)
+			{
+				//	xoshiro128+, the top 24 bits are the good ones
+				const uint32_t result = s0[lane] + s3[lane];
+				const uint32_t t = s1[lane] << 9;
+
+				s2[lane] ^= s0[lane];
+				s3[lane] ^= s1[lane];
+				s1[lane] ^= s2[lane];
+				s0[lane] ^= s3[lane];
+				s2[lane] ^= t;
+				s3[lane] = (s3[lane] << 11) | (s3[lane] >> 21);
+
+				values[lane] = min + (float)(result >> 8) * scale;
+			}
+
+			const size_t n = std::min<size_t>(Lanes, count - i);
+			for (size_t lane = 0; lane < n; lane++)
+				out[i + lane] = values[lane];
+			i += n;
+		}
+
+		for (uint32_t lane = 0; lane < Lanes; lane++)
+		{
+			m_LaneState[0][lane] = s0[lane];
+			m_LaneState[1][lane] = s1[lane];
+			m_LaneState[2][lane] = s2[lane];
+			m_LaneState[3][lane] = s3[lane];
+		}
+	}
+
+	RandomEngine& Random::GetThreadEngine()
+	{
+		//	One device read for the process, each thread then hashes the next value of a plain counter.
+		//	Stepping the seed by SplitMix64's own increment would hand every thread the previous
+		//	thread's state words shifted by one.
+		static const uint64_t s_BaseSeed = []()
+		{
+			std::random_device device;
+			return ((uint64_t)device() << 32) ^ device();
+		}();
+		static std::atomic<uint64_t> s_ThreadCount = 0;
+
+		thread_local RandomEngine s_Engine([]()
+		{
+			uint64_t seed = s_BaseSeed ^ s_ThreadCount.fetch_add(1, std::memory_order_relaxed);
+			return SplitMix64(seed);
+		}());
+		return s_Engine;
+	}
+
+}	//	END namespace RAPIER
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RAPIER
+{
+	//	xoshiro256** for integers, plus 8 interleaved xoshiro128+ lanes for bulk floats. The lanes are
+	//	independent, so Fill() loops over them in a way the compiler turns into vector code.
+	class RandomEngine
+	{
+	public:
+		explicit RandomEngine(uint64_t seed);
+
+		uint64_t UInt64();
+		uint32_t UInt32() { return (uint32_t)(UInt64() >> 32); }
+		//	[0, 1)
+		float Float() { return (float)(UInt64() >> 40) * (1.0f / 16777216.0f); }
+		float Float(float min, float max) { return min + (max - min) * Float(); }
+
+		//	count floats in [min, max)
+		void Fill(float* out, size_t count, float min = 0.0f, float max = 1.0f);
+	private:
+		static constexpr uint32_t Lanes = 8;
+
+		uint64_t m_State[4];
+		uint32_t m_LaneState[4][Lanes];
+	};
+
+	//	Per thread generators, each seeded once from a shared sequence so no two threads share a stream.
+	//	Nothing here locks, anything may call it from any thread.
+	class Random
+	{
+	public:
+		static RandomEngine& GetThreadEngine();
+
+		static uint64_t UInt64() { return GetThreadEngine().UInt64(); }
+		static uint32_t UInt32() { return GetThreadEngine().UInt32(); }
+		static float Float() { return GetThreadEngine().Float(); }
+		static float Float(float min, float max) { return GetThreadEngine().Float(min, max); }
+		static void Fill(float* out, size_t count, float min = 0.0f, float max = 1.0f) { GetThreadEngine().Fill(out, count, min, max); }
+	};
+
+}	//	END namespace RAPIER
@@ -1,26 +1,123 @@
 #pragma once
 
 #include <stdint.h>
+#include <atomic>
+#include <thread>
+
+#include "CoreConfig.h"
 
 namespace RAPIER
 {
+	class RefCounted;
+
+	//	Shared between an object and its WeakRefs, outlives the object until the last WeakRef is gone
+	struct RefControlBlock
+	{
+		RefCounted* Object = nullptr;
+		std::atomic<uint32_t> WeakCount = 1;	//	The object itself holds one weak count
+		std::atomic_flag Lock = ATOMIC_FLAG_INIT;
+
+		void Acquire()
+		{
+			while (Lock.test_and_set(std::memory_order_acquire))
+				std::this_thread::yield();
+		}
+		void Release() { Lock.clear(std::memory_order_release); }
+
+		void IncWeakCount() { WeakCount.fetch_add(1, std::memory_order_relaxed); }
+		void DecWeakCount()
+		{
+			if (WeakCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
+		}
+	};
+
+#ifdef RP_ENABLE_REF_STATS
+	//	Counts every refcount operation, used by Benchmarks::RefCountChurn
+	struct RefStats
+	{
+		inline static std::atomic<uint64_t> Increments = 0;
+		inline static std::atomic<uint64_t> Decrements = 0;
+
+		static uint64_t GetTotal() { return Increments.load(std::memory_order_relaxed) + Decrements.load(std::memory_order_relaxed); }
+		static void Reset() { Increments = 0; Decrements = 0; }
+	};
+	#define RP_REF_STATS_INC(counter) ::RAPIER::RefStats::counter.fetch_add(1, std::memory_order_relaxed)
+#else
+	#define RP_REF_STATS_INC(counter)
+#endif
+
 	class RefCounted
 	{
 	public:
+		RefCounted() = default;
+		//	Copies are new objects, they never share the count or the weak references of the source
+		RefCounted(const RefCounted&) {}
+		RefCounted& operator=(const RefCounted&) { return *this; }
+
+		~RefCounted()
+		{
+			RefControlBlock* controlBlock = m_ControlBlock.load(std::memory_order_acquire);
+			if (controlBlock)
+			{
+				//	Waits for any WeakRef::Lock in flight, after this no WeakRef can reach the object
+				controlBlock->Acquire();
+				controlBlock->Object = nullptr;
+				controlBlock->Release();
+				controlBlock->DecWeakCount();
+			}
+		}
+
 		void IncRefCount() const
 		{
-			m_RefCount++;
+			RP_REF_STATS_INC(Increments);
+			m_RefCount.fetch_add(1, std::memory_order_relaxed);
 		}
-		void DecRefCount() const
+		//	Returns the new count, the object can be deleted once it reaches 0
+		uint32_t DecRefCount() const
 		{
-			m_RefCount--;
+			RP_REF_STATS_INC(Decrements);
+			return m_RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
 		}
+		//	Increments only if the object is still alive, used when promoting a WeakRef
+		bool TryIncRefCount() const
+		{
+			uint32_t count = m_RefCount.load(std::memory_order_relaxed);
+			while (count != 0)
+			{
+				if (m_RefCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+				{
+					RP_REF_STATS_INC(Increments);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		uint32_t GetRefCount() const { return m_RefCount.load(std::memory_order_relaxed); }
+
+		RefControlBlock* GetControlBlock() const
+		{
+			RefControlBlock* controlBlock = m_ControlBlock.load(std::memory_order_acquire);
+			if (controlBlock)
+				return controlBlock;
 
-		uint32_t GetRefCount() const { return m_RefCount; }
+			RefControlBlock* newBlock = new RefControlBlock();
+			newBlock->Object = const_cast<RefCounted*>(this);
+			if (m_ControlBlock.compare_exchange_strong(controlBlock, newBlock, std::memory_order_acq_rel))
+				return newBlock;
+
+			delete newBlock;	//	Another thread created it first
+			return controlBlock;
+		}
 	private:
-		mutable uint32_t m_RefCount = 0; // TODO: atomic
+		mutable std::atomic<uint32_t> m_RefCount = 0;
+		mutable std::atomic<RefControlBlock*> m_ControlBlock = nullptr;
 	};
 
+	template<typename T>
+	class WeakRef;
+
 	template<typename T>
 	class Ref
 	{
@@ -51,7 +148,7 @@ namespace RAPIER
 		}
 
 		template<typename T2>
-		Ref(Ref<T2>&& other)
+		Ref(Ref<T2>&& other) noexcept
 		{
 			m_Instance = (T*)other.m_Instance;
 			other.m_Instance = nullptr;
@@ -68,6 +165,14 @@ namespace RAPIER
 			IncRef();
 		}
 
+		//	Without these the templated overloads are not move constructors/assignments and
+		//	every same-type rvalue would go through the copy path
+		Ref(Ref<T>&& other) noexcept
+			: m_Instance(other.m_Instance)
+		{
+			other.m_Instance = nullptr;
+		}
+
 		Ref& operator=(std::nullptr_t)
 		{
 			DecRef();
@@ -77,6 +182,9 @@ namespace RAPIER
 
 		Ref& operator=(const Ref<T>& other)
 		{
+			if (m_Instance == other.m_Instance)
+				return *this;
+
 			other.IncRef();
 			DecRef();
 
@@ -84,23 +192,41 @@ namespace RAPIER
 			return *this;
 		}
 
+		Ref& operator=(Ref<T>&& other) noexcept
+		{
+			if (this != &other)
+			{
+				DecRef();
+
+				m_Instance = other.m_Instance;
+				other.m_Instance = nullptr;
+			}
+			return *this;
+		}
+
 		template<typename T2>
 		Ref& operator=(const Ref<T2>& other)
 		{
+			if ((const void*)m_Instance == (const void*)other.m_Instance)
+				return *this;
+
 			other.IncRef();
 			DecRef();
 
-			m_Instance = other.m_Instance;
+			m_Instance = (T*)other.m_Instance;
 			return *this;
 		}
 
 		template<typename T2>
-		Ref& operator=(Ref<T2>&& other)
+		Ref& operator=(Ref<T2>&& other) noexcept
 		{
-			DecRef();
+			if ((const void*)this != (const void*)&other)
+			{
+				DecRef();
 
-			m_Instance = (T*)other.m_Instance;
-			other.m_Instance = nullptr;
+				m_Instance = (T*)other.m_Instance;
+				other.m_Instance = nullptr;
+			}
 			return *this;
 		}
 
@@ -113,21 +239,28 @@ namespace RAPIER
 		T& operator*() { return *m_Instance; }
 		const T& operator*() const { return *m_Instance; }
 
+		//	Borrowed pointer, valid only while a Ref to the object is alive. Prefer passing
+		//	Raw() or const Ref& through per-draw/per-frame paths instead of copying Refs.
 		T* Raw() { return  m_Instance; }
 		const T* Raw() const { return  m_Instance; }
 
 		void Reset(T* instance = nullptr)
 		{
+			if (instance)
+				instance->IncRefCount();
 			DecRef();
 			m_Instance = instance;
 		}
 
 		template<typename T2>
-		Ref<T2> As()
+		Ref<T2> As() const
 		{
 			return Ref<T2>(*this);
 		}
 
+		bool operator==(const Ref<T>& other) const { return m_Instance == other.m_Instance; }
+		bool operator!=(const Ref<T>& other) const { return m_Instance != other.m_Instance; }
+
 		template<typename... Args>
 		static Ref<T> Create(Args&&... args)
 		{
@@ -144,20 +277,145 @@ namespace RAPIER
 		{
 			if (m_Instance)
 			{
-				m_Instance->DecRefCount();
-				if (m_Instance->GetRefCount() == 0)
+				if (m_Instance->DecRefCount() == 0)
 				{
 					delete m_Instance;
 				}
 			}
 		}
 
+		//	Takes over a reference that was already counted
+		struct AdoptTag {};
+		Ref(T* instance, AdoptTag)
+			: m_Instance(instance)
+		{
+		}
+
 		template<class T2>
 		friend class Ref;
+		template<class T2>
+		friend class WeakRef;
 		T* m_Instance;
 	};
 
+	//	Non-owning reference to a RefCounted object. Lock() returns a strong Ref, or nullptr once
+	//	the object has been destroyed. Safe to use across threads.
+	template<typename T>
+	class WeakRef
+	{
+	public:
+		WeakRef() = default;
+
+		WeakRef(const Ref<T>& ref)
+		{
+			Assign(ref.m_Instance);
+		}
+
+		WeakRef(T* instance)
+		{
+			Assign(instance);
+		}
+
+		WeakRef(const WeakRef<T>& other)
+			: m_Instance(other.m_Instance), m_ControlBlock(other.m_ControlBlock)
+		{
+			if (m_ControlBlock)
+				m_ControlBlock->IncWeakCount();
+		}
+
+		WeakRef(WeakRef<T>&& other) noexcept
+			: m_Instance(other.m_Instance), m_ControlBlock(other.m_ControlBlock)
+		{
+			other.m_Instance = nullptr;
+			other.m_ControlBlock = nullptr;
+		}
+
+		~WeakRef()
+		{
+			if (m_ControlBlock)
+				m_ControlBlock->DecWeakCount();
+		}
+
+		WeakRef& operator=(const WeakRef<T>& other)
+		{
+			if (other.m_ControlBlock)
+				other.m_ControlBlock->IncWeakCount();
+			if (m_ControlBlock)
+				m_ControlBlock->DecWeakCount();
+
+			m_Instance = other.m_Instance;
+			m_ControlBlock = other.m_ControlBlock;
+			return *this;
+		}
+
+		WeakRef& operator=(WeakRef<T>&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (m_ControlBlock)
+					m_ControlBlock->DecWeakCount();
 
-	// TODO: WeakRef
+				m_Instance = other.m_Instance;
+				m_ControlBlock = other.m_ControlBlock;
+				other.m_Instance = nullptr;
+				other.m_ControlBlock = nullptr;
+			}
+			return *this;
+		}
+
+		WeakRef& operator=(const Ref<T>& ref)
+		{
+			return *this = WeakRef<T>(ref);
+		}
+
+		Ref<T> Lock() const
+		{
+			if (!m_ControlBlock)
+				return nullptr;
+
+			Ref<T> result;
+			m_ControlBlock->Acquire();
+			if (m_ControlBlock->Object && m_Instance->TryIncRefCount())
+				result = Ref<T>(m_Instance, typename Ref<T>::AdoptTag());
+			m_ControlBlock->Release();
+			return result;
+		}
+
+		//	Only a hint when other threads hold Refs to the object, use Lock() to access it
+		bool IsValid() const
+		{
+			if (!m_ControlBlock)
+				return false;
+
+			m_ControlBlock->Acquire();
+			bool valid = m_ControlBlock->Object && m_Instance->GetRefCount() > 0;
+			m_ControlBlock->Release();
+			return valid;
+		}
+		operator bool() const { return IsValid(); }
+
+		void Reset()
+		{
+			if (m_ControlBlock)
+				m_ControlBlock->DecWeakCount();
+			m_Instance = nullptr;
+			m_ControlBlock = nullptr;
+		}
+	private:
+		void Assign(T* instance)
+		{
+			static_assert(std::is_base_of<RefCounted, T>::value, "Class is not RefCounted!");
+
+			m_Instance = instance;
+			if (m_Instance)
+			{
+				m_ControlBlock = m_Instance->GetControlBlock();
+				m_ControlBlock->IncWeakCount();
+			}
+		}
+	private:
+		T* m_Instance = nullptr;
+		RefControlBlock* m_ControlBlock = nullptr;
+	};
 
 }	//	END namespace RAPIER
@@ -54,13 +54,15 @@ namespace RAPIER
 	public:
 		void SetPerFrameTiming(const char* name, float time)
 		{
-			if (m_PerFrameData.find(name) == m_PerFrameData.end())
-				m_PerFrameData[name] = 0.0f;
-
 			m_PerFrameData[name] += time;
 		}
 
-		void Clear() { m_PerFrameData.clear(); }
+		//	Keeps the entries so the map does not reallocate its nodes every frame
+		void Clear()
+		{
+			for (auto& [name, time] : m_PerFrameData)
+				time = 0.0f;
+		}
 
 		const std::unordered_map<const char*, float>& GetPerFrameData() const { return m_PerFrameData; }
 	private:
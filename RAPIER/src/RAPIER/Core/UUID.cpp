@@ -1,17 +1,17 @@
 #include "rppch.h"
 #include "UUID.h"
 
-#include <random>
+#include "RAPIER/Core/Random.h"
 
 namespace RAPIER
 {
-	static std::random_device s_RandomDevice;
-	static std::mt19937_64 s_Engine(s_RandomDevice());
-	static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
-
+	//	Thread local generator, entities can be created from any thread without locking
 	UUID::UUID()
-		: m_UUID(s_UniformDistribution(s_Engine))
+		: m_UUID(Random::UInt64())
 	{
+		//	0 means no entity everywhere else
+		while (m_UUID == 0)
+			m_UUID = Random::UInt64();
 	}
 
 	UUID::UUID(uint64_t uuid)
@@ -9,6 +9,8 @@
 
 namespace RAPIER
 {
+	class EventQueue;
+
 	struct WindowSpecification
 	{
 		std::string Title = "RAPIER Application";
@@ -22,8 +24,6 @@ namespace RAPIER
 	class Window : public RefCounted
 	{
 	public:
-		using EventCallbackFn = std::function<void(Event&)>;
-
 		inline virtual ~Window() = default;
 
 		virtual void OnUpdate() = 0;
@@ -37,7 +37,8 @@ namespace RAPIER
 		virtual void CenterWindow() = 0;
 
 		// Window Attributes
-		virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
+		//	Callbacks push into queue, the owner dispatches it
+		virtual void SetEventQueue(EventQueue* queue) = 0;
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSyncEnabled() const = 0;
 		virtual void SetResizable(bool resizable) const = 0;
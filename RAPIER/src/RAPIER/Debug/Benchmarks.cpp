@@ -0,0 +1,206 @@
+#include "rppch.h"
+#include "RAPIER/Debug/Benchmarks.h"
+
+#include "RAPIER/Core/Timer.h"
+#include "RAPIER/Renderer/Renderer2D.h"
+#include "RAPIER/Audio/SimpleBufferOperations.h"
+#include "RAPIER/Audio/OfflineAudioRenderer.h"
+#include "RAPIER/Audio/DSP/Filters/FilterLowPass.h"
+#include "RAPIER/Audio/DSP/Filters/FilterHighPass.h"
+#include "RAPIER/Audio/DSP/Reverb/Reverb.h"
+
+#include <random>
+
+namespace RAPIER
+{
+	//  -----------------------------  REFCOUNT CHURN  -----------------------------  //
+	void Benchmarks::RefCountChurn(uint32_t spriteCount)
+	{
+		RP_CORE_INFO("Benchmark: RefCountChurn ({0} sprites)", spriteCount);
+#ifndef RP_ENABLE_REF_STATS
+		RP_CORE_INFO("  Refcount ops are only counted with RP_ENABLE_REF_STATS, timing only");
+#endif
+
+		Ref<Texture2D> texture = Texture2D::Create(1, 1);
+		uint32_t textureData = 0xffffffff;
+		texture->SetData(&textureData, sizeof(uint32_t));
+		Ref<SubTexture2D> subTexture = SubTexture2D::CreateFromCoords(texture, { 0.0f, 0.0f }, { 1.0f, 1.0f });
+
+		SpriteRendererComponent sprite;
+		sprite.Texture = texture;
+
+		const glm::mat4 transform(1.0f);
+		const float spriteCountF = (float)spriteCount;
+
+		auto measure = [&](const char* name, auto&& draw)
+		{
+			Renderer2D::BeginScene(Camera(), transform);
+#ifdef RP_ENABLE_REF_STATS
+			RefStats::Reset();
+#endif
+			Timer timer;
+			for (uint32_t i = 0; i < spriteCount; i++)
+				draw(i);
+			const float elapsed = timer.ElapsedMillis();
+#ifdef RP_ENABLE_REF_STATS
+			const uint64_t ops = RefStats::GetTotal();
+			RP_CORE_INFO("  {0}: {1:.3f} refcount ops/sprite ({2} inc, {3} dec), {4:.3f}ms", name, (float)ops / spriteCountF,
+				RefStats::Increments.load(), RefStats::Decrements.load(), elapsed);
+#else
+			RP_CORE_INFO("  {0}: {1:.3f}ms", name, elapsed);
+#endif
+			Renderer2D::EndScene();
+		};
+
+		//	"Before" repeats the Ref copy the old SubTexture2D::GetTexture() made by returning by value, on
+		//	top of today's draw. The texture path took a const Ref& and compared slots by value before
+		//	as well, so it has no before row.
+		measure("DrawQuad(Texture2D)", [&](uint32_t) { Renderer2D::DrawQuad(transform, texture); });
+		measure("DrawQuad(SubTexture2D) before", [&](uint32_t)
+		{
+			const Ref<Texture2D> copy = subTexture->GetTexture();
+			Renderer2D::DrawQuad(transform, subTexture);
+		});
+		measure("DrawQuad(SubTexture2D) after", [&](uint32_t) { Renderer2D::DrawQuad(transform, subTexture); });
+		measure("DrawSprite", [&](uint32_t i) { Renderer2D::DrawSprite(transform, sprite, (int)i); });
+	}
+
+	//  -----------------------------  AUDIO MIXING  -----------------------------  //
+	//	The per-channel interleaved loop SimpleBufferOperations used before it was vectorized
+	static void ScalarAddAndApplyGainRamp(float* dest, const float* source, uint32_t destChannel, uint32_t sourceChannel,
+		uint32_t destNumChannels, uint32_t sourceNumChannels, uint32_t numSamples, float gainStart, float gainEnd)
+	{
+		const float delta = (gainEnd - gainStart) / (float)numSamples;
+		for (uint32_t i = 0; i < numSamples; ++i)
+		{
+			dest[i * destNumChannels + destChannel] += source[i * sourceNumChannels + sourceChannel] * gainStart;
+			gainStart += delta;
+		}
+	}
+
+	void Benchmarks::AudioMixing(uint32_t voiceCount, uint32_t frameCount, uint32_t iterations)
+	{
+		RP_CORE_INFO("Benchmark: AudioMixing ({0} voices x {1} frames, {2} iterations)", voiceCount, frameCount, iterations);
+
+		constexpr uint32_t numChannels = 2;
+		const uint32_t samplesPerVoice = frameCount * numChannels;
+
+		std::mt19937 engine(1234);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		std::vector<float> voices((size_t)voiceCount * samplesPerVoice);
+		for (float& sample : voices)
+			sample = distribution(engine);
+
+		auto gainFor = [](uint32_t voice) { return 0.5f + 0.5f * (float)(voice % 7) / 7.0f; };
+
+		//	Mixes every voice into bus once per iteration and returns the time per block
+		auto measure = [&](std::vector<float>& bus, auto&& mixVoice)
+		{
+			bus.assign(samplesPerVoice, 0.0f);
+			Timer timer;
+			for (uint32_t it = 0; it < iterations; it++)
+			{
+				std::fill(bus.begin(), bus.end(), 0.0f);
+				for (uint32_t v = 0; v < voiceCount; v++)
+					mixVoice(bus.data(), voices.data() + (size_t)v * samplesPerVoice, gainFor(v), gainFor(v + 1));
+			}
+			return timer.ElapsedMillis() / (float)iterations;
+		};
+
+		auto maxDifference = [&](const std::vector<float>& a, const std::vector<float>& b)
+		{
+			float maxError = 0.0f;
+			for (uint32_t i = 0; i < samplesPerVoice; i++)
+				maxError = std::max(maxError, std::abs(a[i] - b[i]));
+			return maxError;
+		};
+
+		//	Scalar and SIMD per-channel rows use the same call shape, one call per channel of every voice
+		std::vector<float> scalarBus, perChannelBus, allChannelBus;
+		const float scalarTime = measure(scalarBus, [&](float* bus, const float* voice, float g0, float g1)
+		{
+			for (uint32_t ch = 0; ch < numChannels; ch++)
+				ScalarAddAndApplyGainRamp(bus, voice, ch, ch, numChannels, numChannels, frameCount, g0, g1);
+		});
+		const float perChannelTime = measure(perChannelBus, [&](float* bus, const float* voice, float g0, float g1)
+		{
+			for (uint32_t ch = 0; ch < numChannels; ch++)
+				Audio::SimpleBufferOperations::AddAndApplyGainRamp(bus, voice, ch, ch, numChannels, numChannels, frameCount, g0, g1);
+		});
+		const float allChannelTime = measure(allChannelBus, [&](float* bus, const float* voice, float g0, float g1)
+		{
+			Audio::SimpleBufferOperations::AddAndApplyGainRamp(bus, voice, numChannels, frameCount, g0, g1);
+		});
+
+		RP_CORE_INFO("  Scalar, per channel: {0:.3f}ms per block", scalarTime);
+		RP_CORE_INFO("  SimpleBufferOperations, per channel: {0:.3f}ms per block ({1:.2f}x), max difference {2}",
+			perChannelTime, scalarTime / perChannelTime, maxDifference(scalarBus, perChannelBus));
+		RP_CORE_INFO("  SimpleBufferOperations, all channels in one call: {0:.3f}ms per block, max difference {1}",
+			allChannelTime, maxDifference(scalarBus, allChannelBus));
+	}
+
+	//  -----------------------------  OFFLINE AUDIO RENDER  -----------------------------  //
+	void Benchmarks::OfflineAudioRender(float seconds)
+	{
+		Audio::OfflineRenderSpecification spec;
+		const uint64_t frameCount = (uint64_t)(seconds * (float)spec.SampleRate);
+		RP_CORE_INFO("Benchmark: OfflineAudioRender ({0:.1f}s, {1} Hz, {2} channels)", seconds, spec.SampleRate, spec.NumChannels);
+
+		//	One second of white noise with a fixed seed, looped, so both renders are fed the same input.
+		//	ma_noise can't be used as a sound source, its data source header is wrong in miniaudio 0.10.39.
+		std::vector<float> noise((size_t)spec.SampleRate * spec.NumChannels);
+		std::mt19937 engine(1234);
+		std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+		for (float& sample : noise)
+			sample = distribution(engine);
+
+		auto render = [&](Buffer& output) -> float
+		{
+			Audio::OfflineAudioRenderer renderer;
+			if (!renderer.Initialize(spec))
+				return 0.0f;
+
+			ma_audio_buffer_ref noiseSource;
+			ma_audio_buffer_ref_init(ma_format_f32, spec.NumChannels, noise.data(), spec.SampleRate, &noiseSource);
+
+			ma_sound sound;
+			ma_sound_init_from_data_source(renderer.GetEngine(), &noiseSource, 0, nullptr, &sound);
+			ma_sound_set_looping(&sound, MA_TRUE);
+
+			Audio::DSP::LowPassFilter lowPass;
+			Audio::DSP::HighPassFilter highPass;
+			lowPass.Initialize(renderer.GetEngine(), (ma_node_base*)&sound);
+			highPass.Initialize(renderer.GetEngine(), lowPass.GetNode());
+			Audio::DSP::Reverb reverb;
+			reverb.Initialize(renderer.GetEngine(), highPass.GetNode());
+			reverb.SetParameter(Audio::DSP::Reverb::PreDelay, 20.0f);
+			lowPass.SetCutoffValue(0.1);	//	Normalized to 20 kHz, 2 kHz
+			highPass.SetCutoffValue(0.01);	//	200 Hz
+
+			ma_sound_start(&sound);
+			output = renderer.RenderToBuffer(frameCount);
+
+			reverb.Uninitialize();
+			highPass.Uninitialize();
+			lowPass.Uninitialize();
+			ma_sound_uninit(&sound);
+			ma_audio_buffer_ref_uninit(&noiseSource);
+
+			return renderer.GetLastRenderStats().GetRealtimeFactor(spec.SampleRate);
+		};
+
+		Buffer first, second;
+		const float realtimeFactor = render(first);
+		render(second);
+
+		const bool deterministic = first.Data && second.Data && first.Size == second.Size
+			&& Audio::SimpleBufferOperations::ContentMatches(first.As<float>(), second.As<float>(), (uint32_t)frameCount, spec.NumChannels);
+
+		RP_CORE_INFO("  {0:.1f}x realtime, renders {1}", realtimeFactor, deterministic ? "match" : "DIFFER");
+
+		first.Release();
+		second.Release();
+	}
+
+}	//	END namespace RAPIER
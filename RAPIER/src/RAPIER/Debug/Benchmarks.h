@@ -0,0 +1,25 @@
+#pragma once
+
+#include "RAPIER/Core/Base.h"
+
+namespace RAPIER
+{
+	//	Micro benchmarks for engine hot paths. Results are written to the core log, call them once the
+	//	Application (and Renderer) is initialized or run FORGE --benchmark.
+	class Benchmarks
+	{
+	public:
+		//	Draws spriteCount quads through each Renderer2D texture path and reports the time, plus the
+		//	Ref<T> increments/decrements per sprite when RP_ENABLE_REF_STATS is defined.
+		static void RefCountChurn(uint32_t spriteCount = 10000);
+
+		//	Mixes voiceCount stereo voices of frameCount frames with gain ramps into one bus, with the
+		//	scalar per-channel loop, the per-channel SimpleBufferOperations call and the all-channel one.
+		static void AudioMixing(uint32_t voiceCount = 256, uint32_t frameCount = 1024, uint32_t iterations = 100);
+
+		//	Renders seconds of white noise through the LowPass -> HighPass -> Reverb chain with the device-less
+		//	OfflineAudioRenderer twice, reports the realtime factor and whether both renders match.
+		static void OfflineAudioRender(float seconds = 60.0f);
+	};
+
+}	//	END namespace RAPIER
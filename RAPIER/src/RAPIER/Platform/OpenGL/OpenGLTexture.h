@@ -17,6 +17,7 @@ namespace RAPIER
 		virtual uint32_t GetWidth() const override { return m_Width; }
 		virtual uint32_t GetHeight() const override { return m_Height; }
 		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+		virtual uint64_t GetMemorySize() const override { return (uint64_t)m_Width * m_Height * (m_DataFormat == GL_RGBA ? 4 : 3); }
 
 		virtual void SetData(void* data, uint32_t size) override;
 
@@ -28,8 +29,8 @@ namespace RAPIER
 	private:
 		std::string m_Path;
 		bool m_IsLoaded = false;
-		uint32_t m_Width, m_Height;
-		uint32_t m_RendererID;
-		GLenum m_InternalFormat, m_DataFormat;
+		uint32_t m_Width = 0, m_Height = 0;
+		uint32_t m_RendererID = 0;
+		GLenum m_InternalFormat = 0, m_DataFormat = 0;
 	};
 }	//	END namespace RAPIER
@@ -1,9 +1,7 @@
 #include "rppch.h"
 #include "RAPIER/Platform/Windows/WindowsWindow.h"
 
-#include "RAPIER/Core/Events/ApplicationEvent.h"
-#include "RAPIER/Core/Events/KeyEvent.h"
-#include "RAPIER/Core/Events/MouseEvent.h"
+#include "RAPIER/Core/Events/EventQueue.h"
 
 #include "RAPIER/Renderer/Renderer.h"
 
@@ -90,8 +88,7 @@ namespace RAPIER
 		{
 			WindowData& data = *(WindowData*) glfwGetWindowUserPointer(window);
 
-			WindowResizeEvent event(width, height);
-			data.EventCallback(event);
+			data.Events->Push(EventRecord::WindowResize(width, height));
 			data.Height = height;
 			data.Width = width;
 		});
@@ -99,8 +96,7 @@ namespace RAPIER
 		glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window)
 		{
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			WindowCloseEvent event;
-			data.EventCallback(event);
+			data.Events->Push(EventRecord::WindowClose());
 		});
 
 		glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods)
@@ -111,20 +107,17 @@ namespace RAPIER
 			{
 				case GLFW_PRESS:
 				{
-					KeyPressedEvent event(static_cast<KeyCode>(key), 0);
-					data.EventCallback(event);
+					data.Events->Push(EventRecord::KeyPressed(static_cast<KeyCode>(key), 0));
 					break;
 				}
 				case GLFW_RELEASE:
 				{
-					KeyReleasedEvent event(static_cast<KeyCode>(key));
-					data.EventCallback(event);
+					data.Events->Push(EventRecord::KeyReleased(static_cast<KeyCode>(key)));
 					break;
 				}
 				case GLFW_REPEAT:
 				{
-					KeyPressedEvent event(static_cast<KeyCode>(key), 1);
-					data.EventCallback(event);
+					data.Events->Push(EventRecord::KeyPressed(static_cast<KeyCode>(key), 1));
 					break;
 				}
 			}
@@ -134,8 +127,7 @@ namespace RAPIER
 		{
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
-			KeyTypedEvent event(static_cast<KeyCode>(keycode));
-			data.EventCallback(event);
+			data.Events->Push(EventRecord::KeyTyped(static_cast<KeyCode>(keycode)));
 		});
 
 		glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods)
@@ -146,14 +138,12 @@ namespace RAPIER
 			{
 				case GLFW_PRESS:
 				{
-					MouseButtonPressedEvent event(static_cast<MouseCode>(button));
-					data.EventCallback(event);
+					data.Events->Push(EventRecord::MouseButtonPressed(static_cast<MouseCode>(button)));
 					break;
 				}
 				case GLFW_RELEASE:
 				{
-					MouseButtonReleasedEvent event(static_cast<MouseCode>(button));
-					data.EventCallback(event);
+					data.Events->Push(EventRecord::MouseButtonReleased(static_cast<MouseCode>(button)));
 					break;
 				}
 			}
@@ -163,16 +153,14 @@ namespace RAPIER
 		{
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
-			MouseScrolledEvent event((float)xOffset, (float)yOffset);
-			data.EventCallback(event);
+			data.Events->Push(EventRecord::MouseScrolled((float)xOffset, (float)yOffset));
 		});
 
 		glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos)
 		{
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
-			MouseMovedEvent event((float)xPos, (float)yPos);
-			data.EventCallback(event);
+			data.Events->Push(EventRecord::MouseMoved((float)xPos, (float)yPos));
 		});
 
 		m_ImGuiMouseCursors[ImGuiMouseCursor_Arrow]      = glfwCreateStandardCursor(GLFW_ARROW_CURSOR);
@@ -22,7 +22,7 @@ namespace RAPIER
 		virtual std::pair<float, float> GetWindowPos() const override;
 
 		//	Window Attributes
-		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		inline void SetEventQueue(EventQueue* queue) override { m_Data.Events = queue; }
 		virtual void SetVSync(bool enabled) override;
 		virtual bool IsVSyncEnabled() const override;
 		virtual void SetResizable(bool resizable) const override;
@@ -50,7 +50,7 @@ namespace RAPIER
 			bool VSync;
 			bool Decorations;
 
-			EventCallbackFn EventCallback;
+			EventQueue* Events = nullptr;
 		};	//	END struct WindowData
 
 		WindowData m_Data;
@@ -1,12 +1,16 @@
 #include "rppch.h"
 #include "RenderCommandQueue.h"
 
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+
 #define RP_RENDER_TRACE(...) RP_CORE_TRACE(__VA_ARGS__)
 
 namespace RAPIER
 {
 	RenderCommandQueue::RenderCommandQueue()
 	{
+		RP_MEMORY_TAG(Renderer);
+
 		m_CommandBuffer = new uint8_t[10 * 1024 * 1024]; // 10mb buffer
 		m_CommandBufferPtr = m_CommandBuffer;
 		memset(m_CommandBuffer, 0, 10 * 1024 * 1024);
@@ -2,6 +2,7 @@
 #include "RAPIER/Renderer/Renderer.h"
 #include "RAPIER/Renderer/Renderer2D.h"
 #include "RAPIER/Renderer/SceneRenderer.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 
 namespace RAPIER
 {
@@ -10,6 +11,7 @@ namespace RAPIER
 	void Renderer::Init()
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Renderer);
 
 		RenderCommand::Init();
 		SceneRenderer::Init();
@@ -5,6 +5,8 @@
 #include "RAPIER/Renderer/Shader.h"
 #include "RAPIER/Renderer/UniformBuffer.h"
 #include "RAPIER/Renderer/RenderCommand.h"
+#include "RAPIER/Scene/ParticleSystem.h"
+#include "RAPIER/Core/JobSystem.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -79,6 +81,8 @@ namespace RAPIER
 		float LineWidth = 2.0f;
 
 		//	Storage
+		//	Each slot owns its texture until the slot is reused, so a texture released before the flush
+		//	stays alive. That costs one increment per newly bound texture rather than one per quad.
 		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;	//	TODO: Every asset has an ID
 		uint32_t TextureSlotIndex = 1;	//	0 = WhiteTexture
 
@@ -414,6 +418,24 @@ namespace RAPIER
 
 		s_Data.Stats.QuadCount++;
 	}
+	//	Returns the slot of a texture in the current batch, adding it if needed. Textures are
+	//	compared by pointer, only binding a new slot touches the refcount.
+	float Renderer2D::GetTextureSlot(const Ref<Texture2D>& texture)
+	{
+		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+		{
+			if (s_Data.TextureSlots[i].Raw() == texture.Raw())
+				return (float)i;
+		}
+
+		if (s_Data.TextureSlotIndex >= Renderer2DStorage::MaxTextureSlots)
+			NextBatch();
+
+		const float textureIndex = (float)s_Data.TextureSlotIndex;
+		s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
+		s_Data.TextureSlotIndex++;
+		return textureIndex;
+	}
 	//	Quad with transform and Texture
 	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, int entityID)
 	{
@@ -425,25 +447,7 @@ namespace RAPIER
 		if (s_Data.QuadIndexCount >= Renderer2DStorage::MaxIndices)
 			NextBatch();
 
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-		{
-			if (*s_Data.TextureSlots[i].Raw() == *texture.Raw())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			if (s_Data.TextureSlotIndex >= Renderer2DStorage::MaxTextureSlots)
-				NextBatch();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-			s_Data.TextureSlotIndex++;
-		}
+		const float textureIndex = GetTextureSlot(texture);
 
 		for (size_t i = 0; i < quadVertexCount; i++)
 		{
@@ -467,30 +471,12 @@ namespace RAPIER
 
 		constexpr size_t quadVertexCount = 4;
 		const DrVec2* textureCoords = SubTexture->GetTexCoords();
-		const Ref<Texture2D> texture = SubTexture->GetTexture();
+		const Ref<Texture2D>& texture = SubTexture->GetTexture();
 
 		if (s_Data.QuadIndexCount >= Renderer2DStorage::MaxIndices)
 			NextBatch();
 
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-		{
-			if (*s_Data.TextureSlots[i].Raw() == *texture.Raw())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			if (s_Data.TextureSlotIndex >= Renderer2DStorage::MaxTextureSlots)
-				NextBatch();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-			s_Data.TextureSlotIndex++;
-		}
+		const float textureIndex = GetTextureSlot(texture);
 
 		for (size_t i = 0; i < quadVertexCount; i++)
 		{
@@ -605,6 +591,62 @@ namespace RAPIER
 			DrawQuad(transform, src.Color, entityID);
 	}
 
+	//	Draw Particles
+	void Renderer2D::DrawParticles(const ParticleSystem& particles, const ParticleEmitterProps& props, float depth, int entityID)
+	{
+		RP_PROFILE_RENDERER_FUNC();
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		constexpr uint32_t quadsPerJob = 2048;
+
+		const float* positionsX = particles.GetPositionsX();
+		const float* positionsY = particles.GetPositionsY();
+		const float* rotations = particles.GetRotations();
+		const float* sizesBegin = particles.GetSizesBegin();
+		const float* lifeRemaining = particles.GetLifeRemaining();
+		const float* inverseLifeTimes = particles.GetInverseLifeTimes();
+
+		uint32_t drawn = 0;
+		const uint32_t count = particles.GetCount();
+		while (drawn < count)
+		{
+			if (s_Data.QuadIndexCount >= Renderer2DStorage::MaxIndices)
+				NextBatch();
+
+			//	Fill what's left of the batch, each particle owns its own 4 vertices so jobs never overlap
+			const uint32_t batchQuads = std::min(count - drawn, Renderer2DStorage::MaxQuads - s_Data.QuadIndexCount / 6);
+			QuadVertex* vertices = s_Data.QuadVertexBufferPtr;
+			const uint32_t first = drawn;
+			JobSystem::ParallelFor(batchQuads, quadsPerJob, [=](uint32_t index)
+			{
+				const uint32_t i = first + index;
+				const float life = glm::clamp(lifeRemaining[i] * inverseLifeTimes[i], 0.0f, 1.0f);
+				const glm::vec4 color = glm::mix(props.ColorEnd, props.ColorBegin, life);
+				const float size = glm::mix(props.SizeEnd, sizesBegin[i], life);
+
+				//	QuadVertexPositions rotated and scaled without building a matrix
+				const float c = std::cos(rotations[i]) * size;
+				const float s = std::sin(rotations[i]) * size;
+				QuadVertex* vertex = vertices + (size_t)index * 4;
+				for (uint32_t v = 0; v < 4; v++)
+				{
+					const glm::vec4& corner = s_Data.QuadVertexPositions[v];
+					vertex[v].Position = { positionsX[i] + corner.x * c - corner.y * s, positionsY[i] + corner.x * s + corner.y * c, depth };
+					vertex[v].Color = color;
+					vertex[v].TexCoord = textureCoords[v];
+					vertex[v].TexIndex = 0.0f;	//	White Texture
+					vertex[v].TilingFactor = 1.0f;
+					vertex[v].EntityID = entityID;
+				}
+			});
+
+			s_Data.QuadVertexBufferPtr += (size_t)batchQuads * 4;
+			s_Data.QuadIndexCount += batchQuads * 6;
+			s_Data.Stats.QuadCount += batchQuads;
+			drawn += batchQuads;
+		}
+	}
+
 	// Statistics
 	void Renderer2D::ResetStats()
 	{
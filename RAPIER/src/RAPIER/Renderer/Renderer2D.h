@@ -71,6 +71,9 @@ namespace RAPIER
 		//	Matrix Transform Sprites
 		static void DrawSprite(const glm::mat4& transform, SpriteRendererComponent& src, int entityID);	//	Transform, SpriteRendererComponent
 
+		//	Every live particle as a colored quad, vertices are written straight into the batch in parallel
+		static void DrawParticles(const ParticleSystem& particles, const ParticleEmitterProps& props, float depth, int entityID = -1);
+
 		// Stats
 		struct Statistics
 		{
@@ -87,6 +90,7 @@ namespace RAPIER
 	private:
 		static void StartBatch();
 		static void NextBatch();
+		static float GetTextureSlot(const Ref<Texture2D>& texture);
 	};
 
 }	//	END namespace RAPIER
@@ -12,6 +12,7 @@ namespace RAPIER
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
 		virtual uint32_t GetRendererID() const = 0;
+		virtual uint64_t GetMemorySize() const = 0;	//	Size of the GPU storage in bytes
 
 		virtual void SetData(void* data, uint32_t size) = 0;
 
@@ -3,6 +3,7 @@
 #include "RAPIER/Core/UUID.h"
 #include "RAPIER/Scene/SceneCamera.h"
 #include "RAPIER/Renderer/Texture.h"
+#include "RAPIER/Scene/ParticleSystem.h"
 
 #include "RAPIER/Script/ScriptModuleField.h"
 
@@ -32,6 +33,7 @@ RelationshipComponent
 TransformComponent
 SpriteRendererComponent
 CircleRendererComponent
+ParticleEmitterComponent
 CameraComponent
 NativeScriptComponent
 ScriptComponent
@@ -119,6 +121,27 @@ namespace RAPIER
 		CircleRendererComponent(const glm::vec4& color)
 			: Color(color) {}
 	};
+	//  -----------------------------  PARTICLE EMITTER COMPONENT  -----------------------------  //
+	struct ParticleEmitterComponent
+	{
+		ParticleEmitterProps Props;
+
+		//	Storage for runtime, never shared between copies
+		Ref<ParticleSystem> RuntimeParticles;
+
+		ParticleEmitterComponent() = default;
+		ParticleEmitterComponent(const ParticleEmitterComponent& other)
+			: Props(other.Props) {}
+		ParticleEmitterComponent& operator=(const ParticleEmitterComponent& other)
+		{
+			Props = other.Props;
+			RuntimeParticles = nullptr;
+			return *this;
+		}
+		//	The registry moves components around its pools, those keep the particles
+		ParticleEmitterComponent(ParticleEmitterComponent&& other) = default;
+		ParticleEmitterComponent& operator=(ParticleEmitterComponent&& other) = default;
+	};
 	//  -----------------------------  CAMERA COMPONENT  -----------------------------  //
 	struct CameraComponent
 	{
@@ -168,6 +191,8 @@ namespace RAPIER
 
 		//	Storage for runtime
 		void* RuntimeBody = nullptr;
+		glm::vec2 PreviousPosition = { 0.0f, 0.0f };	//	Before the last physics step, for interpolation
+		float PreviousAngle = 0.0f;
 
 		RigidBody2DComponent() = default;
 		RigidBody2DComponent(const RigidBody2DComponent& other) = default;
@@ -183,6 +208,7 @@ namespace RAPIER
 		float Friction = 0.5f;
 		float Restitution = 0.0f;
 		float RestitutionThreshold = 0.5f; // Threshold when objects stop bouncing
+		bool IsTrigger = false;	//	Reports overlaps instead of colliding
 
 		//	Storage for runtime
 		void* RuntimeFixture = nullptr;
@@ -200,6 +226,7 @@ namespace RAPIER
 		float Friction = 1.0f;
 		float Restitution = 0.0f;
 		float RestitutionThreshold = 0.5f; // Threshold when objects stop bouncing
+		bool IsTrigger = false;	//	Reports overlaps instead of colliding
 
 		// Storage for runtime
 		void* RuntimeFixture = nullptr;
@@ -0,0 +1,180 @@
+#include "rppch.h"
+#include "ParticleSystem.h"
+
+#include "RAPIER/Core/JobSystem.h"
+#include "RAPIER/Core/Random.h"
+
+#include <glm/gtc/constants.hpp>
+
+#if defined(__AVX2__)
+	#define RP_PARTICLE_SIMD_AVX2
+	#include <immintrin.h>
+#elif defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RP_PARTICLE_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define RP_PARTICLE_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace RAPIER
+{
+	//  -----------------------------  SIMD WRAPPERS  -----------------------------  //
+	namespace
+	{
+#if defined(RP_PARTICLE_SIMD_AVX2)
+		using VecF = __m256;
+		constexpr uint32_t Width = 8;
+		inline VecF Load(const float* p) { return _mm256_loadu_ps(p); }
+		inline void Store(float* p, VecF v) { _mm256_storeu_ps(p, v); }
+		inline VecF Set1(float f) { return _mm256_set1_ps(f); }
+		inline VecF Add(VecF a, VecF b) { return _mm256_add_ps(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return _mm256_mul_ps(a, b); }
+#elif defined(RP_PARTICLE_SIMD_SSE2)
+		using VecF = __m128;
+		constexpr uint32_t Width = 4;
+		inline VecF Load(const float* p) { return _mm_loadu_ps(p); }
+		inline void Store(float* p, VecF v) { _mm_storeu_ps(p, v); }
+		inline VecF Set1(float f) { return _mm_set1_ps(f); }
+		inline VecF Add(VecF a, VecF b) { return _mm_add_ps(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return _mm_mul_ps(a, b); }
+#elif defined(RP_PARTICLE_SIMD_NEON)
+		using VecF = float32x4_t;
+		constexpr uint32_t Width = 4;
+		inline VecF Load(const float* p) { return vld1q_f32(p); }
+		inline void Store(float* p, VecF v) { vst1q_f32(p, v); }
+		inline VecF Set1(float f) { return vdupq_n_f32(f); }
+		inline VecF Add(VecF a, VecF b) { return vaddq_f32(a, b); }
+		inline VecF Mul(VecF a, VecF b) { return vmulq_f32(a, b); }
+#else
+		constexpr uint32_t Width = 1;
+#endif
+	}
+
+	//	Particles per job, big enough that scheduling is noise next to the work
+	static constexpr uint32_t SimulationChunkSize = 16384;
+
+	//	x += v * t for a whole array
+	static void Integrate(float* x, const float* v, float t, uint32_t begin, uint32_t end)
+	{
+		uint32_t i = begin;
+#if defined(RP_PARTICLE_SIMD_AVX2) || defined(RP_PARTICLE_SIMD_SSE2) || defined(RP_PARTICLE_SIMD_NEON)
+		const VecF vt = Set1(t);
+		for (; i + Width <= end; i += Width)
+			Store(x + i, Add(Load(x + i), Mul(Load(v + i), vt)));
+#endif
+		for (; i < end; i++)
+			x[i] += v[i] * t;
+	}
+
+	//	x += c for a whole array
+	static void Offset(float* x, float c, uint32_t begin, uint32_t end)
+	{
+		uint32_t i = begin;
+#if defined(RP_PARTICLE_SIMD_AVX2) || defined(RP_PARTICLE_SIMD_SSE2) || defined(RP_PARTICLE_SIMD_NEON)
+		const VecF vc = Set1(c);
+		for (; i + Width <= end; i += Width)
+			Store(x + i, Add(Load(x + i), vc));
+#endif
+		for (; i < end; i++)
+			x[i] += c;
+	}
+
+	ParticleSystem::ParticleSystem(uint32_t maxParticles)
+	{
+		for (std::vector<float>* array : { &m_PositionX, &m_PositionY, &m_VelocityX, &m_VelocityY, &m_Rotation, &m_SizeBegin, &m_LifeRemaining, &m_InverseLifeTime })
+			array->resize(maxParticles);
+	}
+
+	void ParticleSystem::OnUpdate(Timestep ts, const ParticleEmitterProps& props, const glm::vec2& origin)
+	{
+		RP_PROFILE_FUNC();
+
+		Simulate(ts, props);
+		RemoveDead();
+
+		if (!props.Emitting)
+		{
+			m_EmissionAccumulator = 0.0f;
+			return;
+		}
+
+		//	Fractional particles carry over so low rates still emit at high framerates
+		m_EmissionAccumulator += props.EmissionRate * ts;
+		const uint32_t count = (uint32_t)m_EmissionAccumulator;
+		m_EmissionAccumulator -= (float)count;
+		Emit(props, origin, count);
+	}
+
+	void ParticleSystem::Simulate(float ts, const ParticleEmitterProps& props)
+	{
+		RP_PROFILE_FUNC();
+
+		const uint32_t chunkCount = (m_Count + SimulationChunkSize - 1) / SimulationChunkSize;
+		JobSystem::ParallelFor(chunkCount, 1, [=](uint32_t chunk)
+		{
+			const uint32_t begin = chunk * SimulationChunkSize;
+			const uint32_t end = std::min(begin + SimulationChunkSize, m_Count);
+
+			Integrate(m_PositionX.data(), m_VelocityX.data(), ts, begin, end);
+			Integrate(m_PositionY.data(), m_VelocityY.data(), ts, begin, end);
+			Offset(m_VelocityX.data(), props.Acceleration.x * ts, begin, end);
+			Offset(m_VelocityY.data(), props.Acceleration.y * ts, begin, end);
+			Offset(m_Rotation.data(), props.RotationSpeed * ts, begin, end);
+			Offset(m_LifeRemaining.data(), -ts, begin, end);
+		});
+	}
+
+	void ParticleSystem::RemoveDead()
+	{
+		RP_PROFILE_FUNC();
+
+		//	Swap remove, particles of one emitter aren't drawn in any particular order anyway
+		uint32_t i = 0;
+		while (i < m_Count)
+		{
+			if (m_LifeRemaining[i] > 0.0f)
+			{
+				i++;
+				continue;
+			}
+
+			const uint32_t last = --m_Count;
+			m_PositionX[i] = m_PositionX[last];
+			m_PositionY[i] = m_PositionY[last];
+			m_VelocityX[i] = m_VelocityX[last];
+			m_VelocityY[i] = m_VelocityY[last];
+			m_Rotation[i] = m_Rotation[last];
+			m_SizeBegin[i] = m_SizeBegin[last];
+			m_LifeRemaining[i] = m_LifeRemaining[last];
+			m_InverseLifeTime[i] = m_InverseLifeTime[last];
+		}
+	}
+
+	void ParticleSystem::Emit(const ParticleEmitterProps& props, const glm::vec2& origin, uint32_t count)
+	{
+		count = std::min(count, GetCapacity() - m_Count);
+		if (count == 0)
+			return;
+
+		const float lifeTime = std::max(props.LifeTime, 0.0001f);
+
+		const uint32_t begin = m_Count;
+		const uint32_t end = m_Count + count;
+		std::fill(m_PositionX.begin() + begin, m_PositionX.begin() + end, origin.x);
+		std::fill(m_PositionY.begin() + begin, m_PositionY.begin() + end, origin.y);
+		std::fill(m_LifeRemaining.begin() + begin, m_LifeRemaining.begin() + end, lifeTime);
+		std::fill(m_InverseLifeTime.begin() + begin, m_InverseLifeTime.begin() + end, 1.0f / lifeTime);
+
+		//	Variations are uniform around the base value, so they're generated straight into the arrays
+		RandomEngine& random = Random::GetThreadEngine();
+		const glm::vec2 halfVariation = props.VelocityVariation * 0.5f;
+		random.Fill(&m_VelocityX[begin], count, props.Velocity.x - halfVariation.x, props.Velocity.x + halfVariation.x);
+		random.Fill(&m_VelocityY[begin], count, props.Velocity.y - halfVariation.y, props.Velocity.y + halfVariation.y);
+		random.Fill(&m_Rotation[begin], count, 0.0f, 2.0f * glm::pi<float>());
+		random.Fill(&m_SizeBegin[begin], count, props.SizeBegin - props.SizeVariation * 0.5f, props.SizeBegin + props.SizeVariation * 0.5f);
+
+		m_Count = end;
+	}
+
+}	//	END namespace RAPIER
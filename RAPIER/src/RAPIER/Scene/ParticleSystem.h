@@ -0,0 +1,69 @@
+#pragma once
+
+#include "RAPIER/Core/Ref.h"
+#include "RAPIER/Core/Timestep.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace RAPIER
+{
+	struct ParticleEmitterProps
+	{
+		uint32_t MaxParticles = 10000;
+		float EmissionRate = 1000.0f;	//	Particles per second
+		bool Emitting = true;
+
+		float LifeTime = 1.0f;
+		glm::vec2 Velocity = { 0.0f, 1.0f };
+		glm::vec2 VelocityVariation = { 1.0f, 1.0f };
+		glm::vec2 Acceleration = { 0.0f, 0.0f };
+		float RotationSpeed = 0.0f;	//	Radians per second
+
+		glm::vec4 ColorBegin = { 1.0f, 1.0f, 1.0f, 1.0f };
+		glm::vec4 ColorEnd = { 1.0f, 1.0f, 1.0f, 0.0f };
+		float SizeBegin = 0.1f;
+		float SizeEnd = 0.0f;
+		float SizeVariation = 0.05f;
+	};
+
+	//	Live particles of one emitter, stored as structure of arrays and kept packed: dead particles are
+	//	swapped with the last live one, so every loop only ever touches [0, GetCount()).
+	//	Simulation runs in chunks on the job system, Renderer2D::DrawParticles reads the arrays directly.
+	class ParticleSystem : public RefCounted
+	{
+	public:
+		ParticleSystem(uint32_t maxParticles);
+
+		//	Emits at props.EmissionRate from origin and advances every live particle
+		void OnUpdate(Timestep ts, const ParticleEmitterProps& props, const glm::vec2& origin);
+		//	Dropped once the pool is full
+		void Emit(const ParticleEmitterProps& props, const glm::vec2& origin, uint32_t count);
+		void Clear() { m_Count = 0; m_EmissionAccumulator = 0.0f; }
+
+		uint32_t GetCount() const { return m_Count; }
+		uint32_t GetCapacity() const { return (uint32_t)m_LifeRemaining.size(); }
+
+		const float* GetPositionsX() const { return m_PositionX.data(); }
+		const float* GetPositionsY() const { return m_PositionY.data(); }
+		const float* GetRotations() const { return m_Rotation.data(); }
+		const float* GetSizesBegin() const { return m_SizeBegin.data(); }
+		const float* GetLifeRemaining() const { return m_LifeRemaining.data(); }
+		const float* GetInverseLifeTimes() const { return m_InverseLifeTime.data(); }
+	private:
+		void Simulate(float ts, const ParticleEmitterProps& props);
+		void RemoveDead();
+	private:
+		std::vector<float> m_PositionX, m_PositionY;
+		std::vector<float> m_VelocityX, m_VelocityY;
+		std::vector<float> m_Rotation;
+		std::vector<float> m_SizeBegin;
+		std::vector<float> m_LifeRemaining;
+		std::vector<float> m_InverseLifeTime;
+
+		uint32_t m_Count = 0;
+		float m_EmissionAccumulator = 0.0f;
+	};
+
+}	//	END namespace RAPIER
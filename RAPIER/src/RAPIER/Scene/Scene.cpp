@@ -1,9 +1,12 @@
 #include "rppch.h"
 #include "Scene.h"
 
+#include "RAPIER/Core/Memory/AllocationTracker.h"
+#include "RAPIER/Core/Memory/Memory.h"
 #include "Components.h"
 #include "ScriptableEntity.h"
 #include "RAPIER/Renderer/Renderer2D.h"
+#include "RAPIER/Script/ScriptEngine.h"
 
 #include "Entity.h"
 
@@ -16,6 +19,9 @@
 #include <box2d/b2_fixture.h>
 #include <box2d/b2_polygon_shape.h>
 #include <box2d/b2_circle_shape.h>
+#include <box2d/b2_contact.h>
+#include <box2d/b2_world_callbacks.h>
+#include <box2d/b2_distance.h>
 
 namespace RAPIER
 {
@@ -34,6 +40,63 @@ namespace RAPIER
 
 	static const std::string DefaultEntityName = "Entity";
 
+	//  -----------------------------  CONTACT LISTENER  -----------------------------  //
+	//	Box2D reports contacts per fixture pair from inside the step, which runs on a worker. Nothing is
+	//	dispatched from here, the pairs are recorded and Scene hands them to scripts after the step.
+	class ContactListener2D : public b2ContactListener
+	{
+	public:
+		ContactListener2D(std::vector<Scene::Collision2DEvent>& events)
+			: m_Events(events)
+		{
+			m_Events.reserve(1024);
+			m_PairContacts[0].reserve(1024);
+			m_PairContacts[1].reserve(256);
+		}
+
+		virtual void BeginContact(b2Contact* contact) override { Record(contact, true); }
+		virtual void EndContact(b2Contact* contact) override { Record(contact, false); }
+	private:
+		void Record(b2Contact* contact, bool begin)
+		{
+			const b2Fixture* fixtureA = contact->GetFixtureA();
+			const b2Fixture* fixtureB = contact->GetFixtureB();
+			const entt::entity a = (entt::entity)fixtureA->GetBody()->GetUserData().pointer;
+			const entt::entity b = (entt::entity)fixtureB->GetBody()->GetUserData().pointer;
+			const UUID idA = (uint64_t)fixtureA->GetUserData().pointer;
+			const UUID idB = (uint64_t)fixtureB->GetUserData().pointer;
+			const bool trigger = fixtureA->IsSensor() || fixtureB->IsSensor();
+
+			//	Entities with several fixtures touch through several contacts, only the first begin
+			//	and the last end between two entities are reported
+			const uint32_t low = std::min((uint32_t)a, (uint32_t)b);
+			const uint32_t high = std::max((uint32_t)a, (uint32_t)b);
+			const uint64_t pair = ((uint64_t)low << 32) | high;
+
+			auto& pairContacts = m_PairContacts[trigger];
+			if (begin)
+			{
+				if (pairContacts[pair]++ > 0)
+					return;
+			}
+			else
+			{
+				auto it = pairContacts.find(pair);
+				if (it == pairContacts.end())
+					return;
+				if (--it->second > 0)
+					return;
+				pairContacts.erase(it);
+			}
+
+			m_Events.push_back({ a, b, idA, idB, begin, trigger });
+		}
+	private:
+		std::vector<Scene::Collision2DEvent>& m_Events;
+		//	Touching fixture pairs per entity pair, collisions and triggers counted separately
+		std::unordered_map<uint64_t, uint32_t> m_PairContacts[2];
+	};
+
 	std::unordered_map<UUID, Scene*> s_ActiveScenes;
 
 	struct SceneComponent
@@ -54,6 +117,7 @@ namespace RAPIER
 
 	Scene::~Scene()
 	{
+		WaitForPhysics();
 		m_Registry.clear();
 		s_ActiveScenes.erase(m_SceneID);
 	}
@@ -66,6 +130,14 @@ namespace RAPIER
 	void Scene::OnUpdateRuntime(Timestep ts)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Scene);
+
+		//	Physics, picks up the steps started last frame. Scripts may use Box2D from here on.
+		if (m_PhysicsWorld != nullptr)
+		{
+			WaitForPhysics();
+			ApplyPhysicsResults();
+		}
 
 		// Update scripts
 		{
@@ -73,30 +145,43 @@ namespace RAPIER
 			{
 				nsc.Instance->OnUpdate(ts);
 			});
+
+			ScriptEngine::OnUpdateEntities(m_SceneID, ts);
 		}
 
-		//	Physics
+		//	Physics, steps on a worker while this frame renders
 		if (m_PhysicsWorld != nullptr)
+			StepPhysics(ts);
+
+		//	Particles, the other workers simulate while physics runs on one of them
 		{
-			const int32_t velocityIterations = 6;	//	TODO: EXPOSE TO EDITOR
-			const int32_t positionIterations = 2;	//	TODO: EXPOSE TO EDITOR
-			m_PhysicsWorld->Step(ts, velocityIterations, positionIterations);
+			RP_PROFILE_FUNC();
 
-			//	Retrieve transfrom from Box2D
-			auto view = m_Registry.view<RigidBody2DComponent>();
-			for (auto e : view)
+			struct EmitterUpdate
+			{
+				ParticleSystem* System;
+				const ParticleEmitterProps* Props;
+				glm::vec2 Origin;
+			};
+
+			//	Gathered on the main thread, which owns the registry, then updated side by side
+			auto view = m_Registry.view<TransformComponent, ParticleEmitterComponent>();
+			EmitterUpdate* emitters = Memory::GetFrameAllocator().AllocateArray<EmitterUpdate>(view.size_hint());
+			uint32_t emitterCount = 0;
+			for (auto entity : view)
 			{
-				Entity entity = { e, this };
-				auto& transform = entity.GetComponent<TransformComponent>();
-				auto& rb2d = entity.GetComponent<RigidBody2DComponent>();
-
-				//b2Body* body = m_EntityBox2DBodyMap.at(entityID)
-				b2Body* body = (b2Body*)rb2d.RuntimeBody;
-				const auto& position = body->GetPosition();
-				transform.Translation.x = position.x;
-				transform.Translation.y = position.y;
-				transform.Rotation.z = body->GetAngle();
+				auto [transform, emitter] = view.get<TransformComponent, ParticleEmitterComponent>(entity);
+
+				if (!emitter.RuntimeParticles || emitter.RuntimeParticles->GetCapacity() != emitter.Props.MaxParticles)
+					emitter.RuntimeParticles = Ref<ParticleSystem>::Create(emitter.Props.MaxParticles);
+				emitters[emitterCount++] = { emitter.RuntimeParticles.Raw(), &emitter.Props, { transform.Translation.x, transform.Translation.y } };
 			}
+
+			JobSystem::ParallelFor(emitterCount, 1, [=](uint32_t index)
+			{
+				const EmitterUpdate& update = emitters[index];
+				update.System->OnUpdate(ts, *update.Props, update.Origin);
+			});
 		}
 
 		// Render 2D
@@ -145,14 +230,536 @@ namespace RAPIER
 				}
 			}
 
+			{	//	Draw Particles
+				auto view = m_Registry.view<TransformComponent, ParticleEmitterComponent>();
+				for (auto entity : view)
+				{
+					auto [transform, emitter] = view.get<TransformComponent, ParticleEmitterComponent>(entity);
+
+					if (emitter.RuntimeParticles)
+						Renderer2D::DrawParticles(*emitter.RuntimeParticles, emitter.Props, transform.Translation.z, (int)entity);
+				}
+			}
+
 			Renderer2D::EndScene();
 		}
 			
 	}
 
+	void Scene::WaitForPhysics()
+	{
+		if (m_PhysicsJob.IsBusy())
+			JobSystem::Wait(m_PhysicsJob);
+	}
+
+	void Scene::StepPhysics(Timestep ts)
+	{
+		RP_PROFILE_FUNC();
+
+		if (!m_PendingPhysicsBodies.empty())
+		{
+			const bool created = ProcessPendingPhysicsBodies();
+
+			//	Hold the simulation until every body the scene started with exists, so nothing falls through
+			//	ground that hasn't been created yet
+			if (m_PhysicsLoading && !created)
+				return;
+		}
+		m_PhysicsLoading = false;
+
+		if (m_PhysicsBodiesDirty)
+			RebuildPhysicsBodies();
+
+		const PhysicsSettings& settings = m_PhysicsSettings;
+		const float fixedTimestep = settings.FixedTimestep;
+
+		//	Clamped so a very long frame doesn't queue up more steps than MaxSubSteps ever catches up on
+		m_PhysicsAccumulator = std::min(m_PhysicsAccumulator + (float)ts, fixedTimestep * (float)(settings.MaxSubSteps + 1));
+		const uint32_t steps = std::min((uint32_t)(m_PhysicsAccumulator / fixedTimestep), settings.MaxSubSteps);
+		m_PhysicsAccumulator -= fixedTimestep * (float)steps;
+		if (steps == settings.MaxSubSteps)
+			m_PhysicsAccumulator = std::min(m_PhysicsAccumulator, fixedTimestep);
+
+		//	Blend by how far we are into the next step
+		m_PhysicsAlpha = settings.Interpolate ? std::clamp(m_PhysicsAccumulator / fixedTimestep, 0.0f, 1.0f) : 1.0f;
+
+		if (steps == 0)
+			return;
+
+		//	Script callbacks run here on the main thread with the fixed timestep, once per step about to be
+		//	taken. The steps run back to back on the worker, so what the scripts change applies to all of them.
+		for (uint32_t step = 0; step < steps; step++)
+		{
+			m_Registry.view<NativeScriptComponent>().each([=](auto entity, auto& nsc)
+			{
+				nsc.Instance->OnPhysicsUpdate(fixedTimestep);
+			});
+			ScriptEngine::OnPhysicsUpdateEntities(m_SceneID, fixedTimestep);
+		}
+
+		//	Scripts may have destroyed bodies, the worker must not see them
+		if (m_PhysicsBodiesDirty)
+			RebuildPhysicsBodies();
+
+		const int32_t velocityIterations = settings.VelocityIterations;
+		const int32_t positionIterations = settings.PositionIterations;
+		if (settings.Multithreaded)
+		{
+			JobSystem::Execute(m_PhysicsJob, [this, steps, fixedTimestep, velocityIterations, positionIterations]()
+			{
+				RunPhysicsSteps(steps, fixedTimestep, velocityIterations, positionIterations);
+			});
+		}
+		else
+		{
+			RunPhysicsSteps(steps, fixedTimestep, velocityIterations, positionIterations);
+		}
+	}
+
+	void Scene::RunPhysicsSteps(uint32_t steps, float fixedTimestep, int32_t velocityIterations, int32_t positionIterations)
+	{
+		RP_PROFILE_FUNC();
+
+		for (uint32_t step = 0; step < steps; step++)
+		{
+			//	Only the state before the last step is interpolated from
+			if (step == steps - 1)
+			{
+				for (PhysicsBody& physicsBody : m_PhysicsBodies)
+				{
+					physicsBody.PreviousPosition = physicsBody.Position;
+					physicsBody.PreviousAngle = physicsBody.Angle;
+				}
+			}
+
+			m_PhysicsWorld->Step(fixedTimestep, velocityIterations, positionIterations);
+		}
+
+		for (PhysicsBody& physicsBody : m_PhysicsBodies)
+		{
+			const b2Body* body = physicsBody.Body;
+			physicsBody.Awake = body->IsAwake();
+			if (!physicsBody.Awake && physicsBody.Settled)
+				continue;
+
+			const b2Vec2& position = body->GetPosition();
+			physicsBody.Position = { position.x, position.y };
+			physicsBody.Angle = body->GetAngle();
+		}
+	}
+
+	void Scene::ApplyPhysicsResults()
+	{
+		RP_PROFILE_FUNC();
+
+		//	Components may have been added or removed since the step started, the bodies are current again now
+		if (m_PhysicsBodiesDirty)
+			RebuildPhysicsBodies();
+
+		for (PhysicsBody& physicsBody : m_PhysicsBodies)
+		{
+			if (!physicsBody.Awake && physicsBody.Settled)
+				continue;
+
+			//	A body that just fell asleep gets its exact resting transform once
+			const float t = physicsBody.Awake ? m_PhysicsAlpha : 1.0f;
+			physicsBody.Settled = !physicsBody.Awake;
+
+			auto [transform, rb2d] = m_Registry.get<TransformComponent, RigidBody2DComponent>(physicsBody.Entity);
+			transform.Translation.x = glm::mix(physicsBody.PreviousPosition.x, physicsBody.Position.x, t);
+			transform.Translation.y = glm::mix(physicsBody.PreviousPosition.y, physicsBody.Position.y, t);
+			transform.Rotation.z = glm::mix(physicsBody.PreviousAngle, physicsBody.Angle, t);
+
+			//	Kept on the component so a table rebuild doesn't lose it
+			rb2d.PreviousPosition = physicsBody.PreviousPosition;
+			rb2d.PreviousAngle = physicsBody.PreviousAngle;
+		}
+
+		DispatchCollisionEvents();
+	}
+
+	void Scene::DispatchCollisionEvents()
+	{
+		RP_PROFILE_FUNC();
+
+		//	Handlers may destroy entities, which can record more end events, so index rather than iterate
+		for (size_t i = 0; i < m_CollisionEvents.size(); i++)
+		{
+			const Collision2DEvent event = m_CollisionEvents[i];
+			const entt::entity handles[2] = { event.A, event.B };
+			const UUID ids[2] = { event.IDA, event.IDB };
+			for (int self = 0; self < 2; self++)
+			{
+				//	Either side may be gone, destroyed during the step or by a previous handler. Only that side
+				//	misses the event, the other still gets it with the UUID and a null Entity for native scripts.
+				if (!m_Registry.valid(handles[self]))
+					continue;
+
+				Entity entity = { handles[self], this };
+				Entity other = m_Registry.valid(handles[1 - self]) ? Entity(handles[1 - self], this) : Entity();
+				const UUID otherID = ids[1 - self];
+
+				if (auto* nsc = m_Registry.try_get<NativeScriptComponent>(entity); nsc && nsc->Instance)
+				{
+					if (event.Trigger)
+						event.Begin ? nsc->Instance->OnTriggerBegin(other) : nsc->Instance->OnTriggerEnd(other);
+					else
+						event.Begin ? nsc->Instance->OnCollisionBegin(other) : nsc->Instance->OnCollisionEnd(other);
+				}
+
+				//	The native handler may have destroyed it
+				if (m_Registry.valid(entity) && m_Registry.has<ScriptComponent>(entity) && ScriptEngine::IsEntityInstantiated(entity))
+				{
+					if (event.Trigger)
+						event.Begin ? ScriptEngine::OnTriggerBegin(entity, otherID) : ScriptEngine::OnTriggerEnd(entity, otherID);
+					else
+						event.Begin ? ScriptEngine::OnCollision2DBegin(entity, otherID) : ScriptEngine::OnCollision2DEnd(entity, otherID);
+				}
+			}
+		}
+		m_CollisionEvents.clear();
+	}
+
+	void Scene::RebuildPhysicsBodies()
+	{
+		RP_PROFILE_FUNC();
+
+		m_PhysicsBodies.clear();
+		m_PhysicsBodiesDirty = false;
+
+		auto view = m_Registry.view<TransformComponent, RigidBody2DComponent>();
+		for (auto e : view)
+		{
+			auto& rb2d = view.get<RigidBody2DComponent>(e);
+
+			//	Static bodies never move, their transform was final when the body was created
+			b2Body* body = (b2Body*)rb2d.RuntimeBody;
+			if (!body || body->GetType() == b2_staticBody)
+				continue;
+
+			const b2Vec2& position = body->GetPosition();
+			PhysicsBody& physicsBody = m_PhysicsBodies.emplace_back();
+			physicsBody.Body = body;
+			physicsBody.Entity = e;
+			physicsBody.PreviousPosition = rb2d.PreviousPosition;
+			physicsBody.PreviousAngle = rb2d.PreviousAngle;
+			physicsBody.Position = { position.x, position.y };
+			physicsBody.Angle = body->GetAngle();
+			physicsBody.Awake = body->IsAwake();
+			physicsBody.Settled = false;
+		}
+	}
+
+	void Scene::OnPhysicsBodiesChanged(entt::registry& registry, entt::entity entity)
+	{
+		m_PhysicsBodiesDirty = true;
+	}
+
+	void Scene::CreatePhysicsBody(entt::entity entity)
+	{
+		if (!m_Registry.valid(entity))
+			return;
+
+		auto* rb2d = m_Registry.try_get<RigidBody2DComponent>(entity);
+		auto* transform = m_Registry.try_get<TransformComponent>(entity);
+		if (!rb2d || !transform || rb2d->RuntimeBody)
+			return;
+
+		b2BodyDef bodyDef;
+		bodyDef.type = RigidBody2DTypeToBox2DBody(rb2d->Type);
+		bodyDef.position.Set(transform->Translation.x, transform->Translation.y);
+		bodyDef.angle = transform->Rotation.z;
+		bodyDef.userData.pointer = (uintptr_t)entity;
+
+		//	Fixtures carry the entity's UUID, so collision events can still name an entity that is gone by dispatch
+		static_assert(sizeof(uintptr_t) >= sizeof(uint64_t), "Fixture user data can't hold a UUID");
+		const uintptr_t entityID = (uintptr_t)(uint64_t)m_Registry.get<IDComponent>(entity).ID;
+
+		b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
+		body->SetFixedRotation(rb2d->FixedRotation);
+		rb2d->RuntimeBody = body;
+		rb2d->PreviousPosition = { transform->Translation.x, transform->Translation.y };
+		rb2d->PreviousAngle = transform->Rotation.z;
+
+		if (auto* bc2d = m_Registry.try_get<BoxCollider2DComponent>(entity))
+		{
+			b2PolygonShape boxShape;
+			boxShape.SetAsBox(bc2d->Size.x * transform->Scale.x, bc2d->Size.y * transform->Scale.y);
+
+			b2FixtureDef fixtureDef;
+			fixtureDef.shape = &boxShape;
+			fixtureDef.density              = bc2d->Density;
+			fixtureDef.friction             = bc2d->Friction;
+			fixtureDef.restitution          = bc2d->Restitution;
+			fixtureDef.restitutionThreshold = bc2d->RestitutionThreshold;
+			fixtureDef.isSensor             = bc2d->IsTrigger;
+			fixtureDef.userData.pointer     = entityID;
+			bc2d->RuntimeFixture = body->CreateFixture(&fixtureDef);
+		}
+		if (auto* cc2d = m_Registry.try_get<CircleCollider2DComponent>(entity))
+		{
+			b2CircleShape circleShape;
+			circleShape.m_radius = transform->Scale.x * cc2d->Radius;
+
+			b2FixtureDef fixtureDef;
+			fixtureDef.shape = &circleShape;
+			fixtureDef.density = cc2d->Density;
+			fixtureDef.friction = cc2d->Friction;
+			fixtureDef.restitution = cc2d->Restitution;
+			fixtureDef.restitutionThreshold = cc2d->RestitutionThreshold;
+			fixtureDef.isSensor = cc2d->IsTrigger;
+			fixtureDef.userData.pointer = entityID;
+			cc2d->RuntimeFixture = body->CreateFixture(&fixtureDef);
+		}
+
+		m_PhysicsBodiesDirty = true;
+	}
+
+	void Scene::DestroyPhysicsBody(entt::entity entity)
+	{
+		auto* rb2d = m_Registry.try_get<RigidBody2DComponent>(entity);
+		if (!rb2d || !rb2d->RuntimeBody)
+			return;
+
+		//	Components can be removed from the editor while a step is in flight
+		WaitForPhysics();
+
+		m_PhysicsWorld->DestroyBody((b2Body*)rb2d->RuntimeBody);
+		rb2d->RuntimeBody = nullptr;
+		if (auto* bc2d = m_Registry.try_get<BoxCollider2DComponent>(entity))
+			bc2d->RuntimeFixture = nullptr;
+		if (auto* cc2d = m_Registry.try_get<CircleCollider2DComponent>(entity))
+			cc2d->RuntimeFixture = nullptr;
+
+		m_PhysicsBodiesDirty = true;
+	}
+
+	bool Scene::ProcessPendingPhysicsBodies()
+	{
+		RP_PROFILE_FUNC();
+
+		const uint32_t budget = m_PhysicsSettings.BodyCreationBudget;
+		const size_t count = budget > 0 ? std::min<size_t>(budget, m_PendingPhysicsBodies.size()) : m_PendingPhysicsBodies.size();
+
+		//	Entities queued more than once are skipped once their body exists
+		for (size_t i = 0; i < count; i++)
+			CreatePhysicsBody(m_PendingPhysicsBodies[i]);
+
+		m_PendingPhysicsBodies.erase(m_PendingPhysicsBodies.begin(), m_PendingPhysicsBodies.begin() + count);
+		return m_PendingPhysicsBodies.empty();
+	}
+
+	void Scene::OnRigidBody2DConstruct(entt::registry& registry, entt::entity entity)
+	{
+		//	Copies (DuplicateEntity) carry the runtime body of the source
+		registry.get<RigidBody2DComponent>(entity).RuntimeBody = nullptr;
+		m_PendingPhysicsBodies.push_back(entity);
+		m_PhysicsBodiesDirty = true;
+	}
+
+	void Scene::OnRigidBody2DDestroy(entt::registry& registry, entt::entity entity)
+	{
+		DestroyPhysicsBody(entity);
+	}
+
+	template<typename T>
+	void Scene::OnCollider2DConstruct(entt::registry& registry, entt::entity entity)
+	{
+		registry.get<T>(entity).RuntimeFixture = nullptr;
+
+		//	Fixtures are only created with the body, so rebuild the body
+		if (registry.has<RigidBody2DComponent>(entity))
+		{
+			DestroyPhysicsBody(entity);
+			m_PendingPhysicsBodies.push_back(entity);
+		}
+	}
+
+	void Scene::OnCollider2DDestroy(entt::registry& registry, entt::entity entity)
+	{
+		//	The collider is still attached while this runs, the body is recreated without it later
+		if (registry.has<RigidBody2DComponent>(entity))
+		{
+			DestroyPhysicsBody(entity);
+			m_PendingPhysicsBodies.push_back(entity);
+		}
+	}
+
+	//  -----------------------------  PHYSICS QUERIES  -----------------------------  //
+	//	The broadphase is only read here and the main thread waits in ParallelFor, so the queries can share
+	//	the world and the registry across workers as long as no step is in flight.
+	static constexpr uint32_t PhysicsQueryGroupSize = 32;
+
+	class ClosestRaycastCallback : public b2RayCastCallback
+	{
+	public:
+		virtual float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override
+		{
+			if (fixture->IsSensor())
+				return -1.0f;
+
+			Fixture = fixture;
+			Point = point;
+			Normal = normal;
+			Fraction = fraction;
+			return fraction;	//	Clip the ray, only closer fixtures are reported from here on
+		}
+
+		b2Fixture* Fixture = nullptr;
+		b2Vec2 Point;
+		b2Vec2 Normal;
+		float Fraction = 1.0f;
+	};
+
+	template<typename Func>
+	class QueryAABBCallback : public b2QueryCallback
+	{
+	public:
+		QueryAABBCallback(Func func)
+			: m_Func(func) {}
+
+		virtual bool ReportFixture(b2Fixture* fixture) override
+		{
+			if (!fixture->IsSensor())
+				m_Func(fixture);
+			return true;
+		}
+	private:
+		Func m_Func;
+	};
+
+	template<typename Func>
+	static void QueryAABB(b2World* world, const b2AABB& aabb, Func func)
+	{
+		QueryAABBCallback<Func> callback(func);
+		world->QueryAABB(&callback, aabb);
+	}
+
+	//	Through a const registry, which never creates pools
+	static uint64_t GetFixtureEntityID(const entt::registry& registry, const b2Fixture* fixture)
+	{
+		const entt::entity entity = (entt::entity)fixture->GetBody()->GetUserData().pointer;
+		return registry.get<IDComponent>(entity).ID;
+	}
+
+	void Scene::Raycast2D(const PhysicsRay2D* rays, uint32_t count, PhysicsHit2D* outHits)
+	{
+		RP_PROFILE_FUNC();
+
+		WaitForPhysics();
+		JobSystem::ParallelFor(count, PhysicsQueryGroupSize, [=](uint32_t i)
+		{
+			const PhysicsRay2D& ray = rays[i];
+			PhysicsHit2D& hit = outHits[i];
+			hit = {};
+
+			const float length = glm::length(ray.Direction);
+			if (!m_PhysicsWorld || length <= 0.0f || ray.MaxDistance <= 0.0f)
+				return;
+
+			const glm::vec2 end = ray.Origin + ray.Direction * (ray.MaxDistance / length);
+			ClosestRaycastCallback callback;
+			m_PhysicsWorld->RayCast(&callback, { ray.Origin.x, ray.Origin.y }, { end.x, end.y });
+			if (!callback.Fixture)
+				return;
+
+			hit.EntityID = GetFixtureEntityID(m_Registry, callback.Fixture);
+			hit.Point = { callback.Point.x, callback.Point.y };
+			hit.Normal = { callback.Normal.x, callback.Normal.y };
+			hit.Distance = callback.Fraction * ray.MaxDistance;
+		});
+	}
+
+	void Scene::CircleCast2D(const PhysicsCircleCast2D* casts, uint32_t count, PhysicsHit2D* outHits)
+	{
+		RP_PROFILE_FUNC();
+
+		WaitForPhysics();
+		JobSystem::ParallelFor(count, PhysicsQueryGroupSize, [=](uint32_t i)
+		{
+			const PhysicsCircleCast2D& cast = casts[i];
+			PhysicsHit2D& hit = outHits[i];
+			hit = {};
+
+			const float length = glm::length(cast.Direction);
+			if (!m_PhysicsWorld || length <= 0.0f || cast.MaxDistance < 0.0f || cast.Radius <= 0.0f)
+				return;
+
+			const glm::vec2 translation = cast.Direction * (cast.MaxDistance / length);
+			const glm::vec2 end = cast.Origin + translation;
+
+			b2CircleShape circle;
+			circle.m_radius = cast.Radius;
+
+			b2ShapeCastInput input;
+			input.proxyB.Set(&circle, 0);
+			input.transformB.Set({ cast.Origin.x, cast.Origin.y }, 0.0f);
+			input.translationB = { translation.x, translation.y };
+
+			//	The world has no shape cast, so sweep the circle against every fixture under its swept bounds
+			b2AABB sweptBounds;
+			sweptBounds.lowerBound = { std::min(cast.Origin.x, end.x) - cast.Radius, std::min(cast.Origin.y, end.y) - cast.Radius };
+			sweptBounds.upperBound = { std::max(cast.Origin.x, end.x) + cast.Radius, std::max(cast.Origin.y, end.y) + cast.Radius };
+
+			float closest = 2.0f;
+			QueryAABB(m_PhysicsWorld, sweptBounds, [&](b2Fixture* fixture)
+			{
+				input.proxyA.Set(fixture->GetShape(), 0);
+				input.transformA = fixture->GetBody()->GetTransform();
+
+				b2ShapeCastOutput output;
+				if (!b2ShapeCast(&output, &input) || output.lambda >= closest)
+					return;
+
+				closest = output.lambda;
+				hit.EntityID = GetFixtureEntityID(m_Registry, fixture);
+				hit.Point = { output.point.x, output.point.y };
+				hit.Normal = { output.normal.x, output.normal.y };
+				hit.Distance = output.lambda * cast.MaxDistance;
+			});
+		});
+	}
+
+	void Scene::OverlapAABB2D(const PhysicsAABB2D* boxes, uint32_t count, uint32_t maxResultsPerBox, uint64_t* outEntityIDs, uint32_t* outCounts)
+	{
+		RP_PROFILE_FUNC();
+
+		WaitForPhysics();
+		JobSystem::ParallelFor(count, PhysicsQueryGroupSize, [=](uint32_t i)
+		{
+			uint32_t& found = outCounts[i];
+			found = 0;
+			if (!m_PhysicsWorld)
+				return;
+
+			b2AABB aabb;
+			aabb.lowerBound = { boxes[i].Min.x, boxes[i].Min.y };
+			aabb.upperBound = { boxes[i].Max.x, boxes[i].Max.y };
+
+			uint64_t* results = outEntityIDs + (size_t)i * maxResultsPerBox;
+			QueryAABB(m_PhysicsWorld, aabb, [&](b2Fixture* fixture)
+			{
+				//	The broadphase works on fattened bounds, check against the fixture's own
+				if (!b2TestOverlap(aabb, fixture->GetAABB(0)))
+					return;
+
+				//	Bodies with several fixtures are only reported once
+				const uint64_t id = GetFixtureEntityID(m_Registry, fixture);
+				const uint32_t written = std::min(found, maxResultsPerBox);
+				if (std::find(results, results + written, id) != results + written)
+					return;
+
+				if (found < maxResultsPerBox)
+					results[found] = id;
+				found++;
+			});
+		});
+	}
+
 	void Scene::OnUpdateEditor(Timestep ts, EditorCamera& camera)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Scene);
 
 		Renderer2D::BeginScene(camera);
 
@@ -181,6 +788,8 @@ namespace RAPIER
 
 	void Scene::OnRuntimeStart()
 	{
+		RP_MEMORY_TAG(Scene);
+
 		{	//	Initialize Scripts
 			m_Registry.view<NativeScriptComponent>().each([=](auto entity, auto& nsc)
 			{
@@ -192,68 +801,62 @@ namespace RAPIER
 				}
 			});
 		}
-		m_PhysicsWorld = new b2World({ 0.0f, -9.8f });
+		m_PhysicsWorld = new b2World({ m_PhysicsSettings.Gravity.x, m_PhysicsSettings.Gravity.y });
+		m_ContactListener = new ContactListener2D(m_CollisionEvents);
+		m_PhysicsWorld->SetContactListener(m_ContactListener);
+		m_PhysicsAccumulator = 0.0f;
+		m_PhysicsBodiesDirty = true;
+
+		m_Registry.on_construct<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DConstruct>(*this);
+		m_Registry.on_destroy<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DDestroy>(*this);
+		m_Registry.on_construct<BoxCollider2DComponent>().connect<&Scene::OnCollider2DConstruct<BoxCollider2DComponent>>(*this);
+		m_Registry.on_destroy<BoxCollider2DComponent>().connect<&Scene::OnCollider2DDestroy>(*this);
+		m_Registry.on_construct<CircleCollider2DComponent>().connect<&Scene::OnCollider2DConstruct<CircleCollider2DComponent>>(*this);
+		m_Registry.on_destroy<CircleCollider2DComponent>().connect<&Scene::OnCollider2DDestroy>(*this);
+		//	The body table is built from the Transform and RigidBody2D view, so it follows both pools
+		m_Registry.on_construct<TransformComponent>().connect<&Scene::OnPhysicsBodiesChanged>(*this);
+		m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnPhysicsBodiesChanged>(*this);
+
+		//	Created over the first frames within BodyCreationBudget, see StepPhysics
 		auto view = m_Registry.view<RigidBody2DComponent>();
-		for (auto e : view)
-		{
-			Entity entity = { e, this };
-			auto& transform = entity.GetComponent<TransformComponent>();
-			auto& rb2d = entity.GetComponent<RigidBody2DComponent>();
-
-			b2BodyDef bodyDef;
-			bodyDef.type = RigidBody2DTypeToBox2DBody(rb2d.Type);
-			bodyDef.position.Set(transform.Translation.x, transform.Translation.y);
-			bodyDef.angle = transform.Rotation.z;
-
-			b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
-			body->SetFixedRotation(rb2d.FixedRotation);
-			rb2d.RuntimeBody = body;
-
-			if (entity.HasComponent<BoxCollider2DComponent>())
-			{
-				auto& bc2d = entity.GetComponent<BoxCollider2DComponent>();
-
-				b2PolygonShape boxShape;
-				boxShape.SetAsBox(bc2d.Size.x * transform.Scale.x, bc2d.Size.y * transform.Scale.y);
-
-				b2FixtureDef fixtureDef;
-				fixtureDef.shape = &boxShape;
-				fixtureDef.density              = bc2d.Density;
-				fixtureDef.friction             = bc2d.Friction;
-				fixtureDef.restitution          = bc2d.Restitution;
-				fixtureDef.restitutionThreshold = bc2d.RestitutionThreshold;
-				body->CreateFixture(&fixtureDef);
-			}
-			if (entity.HasComponent<CircleCollider2DComponent>())
-			{
-				auto& cc2d = entity.GetComponent<CircleCollider2DComponent>();
-
-				b2CircleShape circleShape;
-				circleShape.m_radius = transform.Scale.x * cc2d.Radius;
-
-				b2FixtureDef fixtureDef;
-				fixtureDef.shape = &circleShape;
-				fixtureDef.density = cc2d.Density;
-				fixtureDef.friction = cc2d.Friction;
-				fixtureDef.restitution = cc2d.Restitution;
-				fixtureDef.restitutionThreshold = cc2d.RestitutionThreshold;
-				body->CreateFixture(&fixtureDef);
-			}
-		}
+		m_PendingPhysicsBodies.assign(view.begin(), view.end());
+		m_PhysicsLoading = true;
 
 		m_IsPlaying = true;
 	}
 
 	void Scene::OnRuntimeStop()
 	{
+		WaitForPhysics();
+
 		{	//	Stop Scripts
 			m_Registry.view<NativeScriptComponent>().each([=](auto entity, auto& nsc)
 			{
 				nsc.Instance = nullptr;
 			});
 		}
+		m_Registry.on_construct<RigidBody2DComponent>().disconnect<&Scene::OnRigidBody2DConstruct>(*this);
+		m_Registry.on_destroy<RigidBody2DComponent>().disconnect<&Scene::OnRigidBody2DDestroy>(*this);
+		m_Registry.on_construct<BoxCollider2DComponent>().disconnect<&Scene::OnCollider2DConstruct<BoxCollider2DComponent>>(*this);
+		m_Registry.on_destroy<BoxCollider2DComponent>().disconnect<&Scene::OnCollider2DDestroy>(*this);
+		m_Registry.on_construct<CircleCollider2DComponent>().disconnect<&Scene::OnCollider2DConstruct<CircleCollider2DComponent>>(*this);
+		m_Registry.on_destroy<CircleCollider2DComponent>().disconnect<&Scene::OnCollider2DDestroy>(*this);
+		m_Registry.on_construct<TransformComponent>().disconnect<&Scene::OnPhysicsBodiesChanged>(*this);
+		m_Registry.on_destroy<TransformComponent>().disconnect<&Scene::OnPhysicsBodiesChanged>(*this);
+		m_PhysicsBodies.clear();
+		m_PendingPhysicsBodies.clear();
+
+		//	The world owns the bodies, don't leave dangling pointers behind
+		m_Registry.view<RigidBody2DComponent>().each([](auto entity, auto& rb2d) { rb2d.RuntimeBody = nullptr; });
+		m_Registry.view<BoxCollider2DComponent>().each([](auto entity, auto& bc2d) { bc2d.RuntimeFixture = nullptr; });
+		m_Registry.view<CircleCollider2DComponent>().each([](auto entity, auto& cc2d) { cc2d.RuntimeFixture = nullptr; });
+		m_Registry.view<ParticleEmitterComponent>().each([](auto entity, auto& emitter) { emitter.RuntimeParticles = nullptr; });
+
 		delete m_PhysicsWorld;
 		m_PhysicsWorld = nullptr;
+		delete m_ContactListener;
+		m_ContactListener = nullptr;
+		m_CollisionEvents.clear();
 		m_IsPlaying = false;
 	}
 
@@ -364,6 +967,7 @@ namespace RAPIER
 		CopyComponentIfExists<CameraComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
 		CopyComponentIfExists<SpriteRendererComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
 		CopyComponentIfExists<CircleRendererComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
+		CopyComponentIfExists<ParticleEmitterComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
 		CopyComponentIfExists<SpriteRendererComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
 		CopyComponentIfExists<RigidBody2DComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
 		CopyComponentIfExists<BoxCollider2DComponent>(newEntity.m_EntityHandle, entity.m_EntityHandle, m_Registry);
@@ -401,6 +1005,7 @@ namespace RAPIER
 	//	Copy to runtime
 	void Scene::CopyTo(Ref<Scene>& target)
 	{
+		target->m_PhysicsSettings = m_PhysicsSettings;
 
 		std::unordered_map<UUID, entt::entity> enttMap;
 
@@ -418,6 +1023,7 @@ namespace RAPIER
 		CopyComponent<CameraComponent>(target->m_Registry, m_Registry, enttMap);
 		CopyComponent<SpriteRendererComponent>(target->m_Registry, m_Registry, enttMap);
 		CopyComponent<CircleRendererComponent>(target->m_Registry, m_Registry, enttMap);
+		CopyComponent<ParticleEmitterComponent>(target->m_Registry, m_Registry, enttMap);
 		CopyComponent<RigidBody2DComponent>(target->m_Registry, m_Registry, enttMap);
 		CopyComponent<BoxCollider2DComponent>(target->m_Registry, m_Registry, enttMap);
 		CopyComponent<CircleCollider2DComponent>(target->m_Registry, m_Registry, enttMap);
@@ -474,6 +1080,11 @@ namespace RAPIER
 	void Scene::OnComponentAdded<CircleRendererComponent>(Entity entity, CircleRendererComponent& component)
 	{
 	}
+	//  -----------------------------  PARTICLE EMITTER COMPONENT  -----------------------------  //
+	template<>
+	void Scene::OnComponentAdded<ParticleEmitterComponent>(Entity entity, ParticleEmitterComponent& component)
+	{
+	}
 	//  -----------------------------  NATIVE SCRIPT COMPONENT  -----------------------------  //
 	template<>
 	void Scene::OnComponentAdded<NativeScriptComponent>(Entity entity, NativeScriptComponent& component)
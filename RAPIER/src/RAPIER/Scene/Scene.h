@@ -2,18 +2,71 @@
 
 #include "RAPIER/Core/UUID.h"
 #include "RAPIER/Core/Timestep.h"
+#include "RAPIER/Core/JobSystem.h"
 #include "RAPIER/Renderer/EditorCamera.h"
 
 #include <entt.hpp>
-//#include <glm/glm.hpp>
+#include <glm/glm.hpp>
 
 class b2World;
+class b2Body;
 
 namespace RAPIER
 {
 	class Entity;
+	class ContactListener2D;
+	struct TransformComponent;
+	struct RigidBody2DComponent;
 	using EntityMap = std::unordered_map<UUID, Entity>;
 
+	struct PhysicsSettings
+	{
+		float FixedTimestep = 1.0f / 60.0f;
+		//	Steps per frame at most, time beyond that is dropped so a hitch can't spiral
+		uint32_t MaxSubSteps = 8;
+		int32_t VelocityIterations = 6;
+		int32_t PositionIterations = 2;
+		glm::vec2 Gravity = { 0.0f, -9.8f };
+		//	Render transforms blend between the last two steps, otherwise they snap to the latest one
+		bool Interpolate = true;
+		//	Step on a worker while the frame renders, results are picked up at the start of the next frame
+		bool Multithreaded = true;
+		//	Bodies created per frame at most, 0 for no limit. The simulation starts once the initial ones exist.
+		uint32_t BodyCreationBudget = 1024;
+	};
+
+	//	Physics queries take whole batches and fill flat arrays, layouts are shared with POMMEL's Physics2D.
+	//	Triggers are never hit. Direction doesn't need to be normalized.
+	struct PhysicsRay2D
+	{
+		glm::vec2 Origin;
+		glm::vec2 Direction;
+		float MaxDistance;
+	};
+
+	struct PhysicsCircleCast2D
+	{
+		glm::vec2 Origin;
+		glm::vec2 Direction;
+		float MaxDistance;
+		float Radius;
+	};
+
+	struct PhysicsAABB2D
+	{
+		glm::vec2 Min;
+		glm::vec2 Max;
+	};
+
+	//	Closest hit along a ray or cast, EntityID is 0 if nothing was hit
+	struct PhysicsHit2D
+	{
+		uint64_t EntityID;
+		glm::vec2 Point;
+		glm::vec2 Normal;
+		float Distance;
+	};
+
 	class Scene : public RefCounted
 	{
 	public:
@@ -50,9 +103,38 @@ namespace RAPIER
 		const std::string& GetName() const { return m_DebugName; }
 
 		static Ref<Scene> GetScene(UUID uuid);
+
+		PhysicsSettings& GetPhysicsSettings() { return m_PhysicsSettings; }
+		const PhysicsSettings& GetPhysicsSettings() const { return m_PhysicsSettings; }
+		//	Box2D must not be touched while a step is in flight
+		void WaitForPhysics();
+
+		//	Batches run in parallel on the job system, one result per query
+		void Raycast2D(const PhysicsRay2D* rays, uint32_t count, PhysicsHit2D* outHits);
+		void CircleCast2D(const PhysicsCircleCast2D* casts, uint32_t count, PhysicsHit2D* outHits);
+		//	Up to maxResultsPerBox entities per box, box i writes from outEntities[i * maxResultsPerBox].
+		//	outCounts[i] is the number found, which may be larger than what was written.
+		void OverlapAABB2D(const PhysicsAABB2D* boxes, uint32_t count, uint32_t maxResultsPerBox, uint64_t* outEntityIDs, uint32_t* outCounts);
 	private:
 		template<typename T>
 		void OnComponentAdded(Entity entity, T& component);
+
+		void StepPhysics(Timestep ts);
+		void RunPhysicsSteps(uint32_t steps, float fixedTimestep, int32_t velocityIterations, int32_t positionIterations);
+		void ApplyPhysicsResults();
+		void RebuildPhysicsBodies();
+		void OnPhysicsBodiesChanged(entt::registry& registry, entt::entity entity);
+
+		//	Bodies are created lazily from component hooks, so anything added during play gets physics
+		void CreatePhysicsBody(entt::entity entity);
+		void DestroyPhysicsBody(entt::entity entity);
+		bool ProcessPendingPhysicsBodies();
+		void OnRigidBody2DConstruct(entt::registry& registry, entt::entity entity);
+		void OnRigidBody2DDestroy(entt::registry& registry, entt::entity entity);
+		template<typename T>
+		void OnCollider2DConstruct(entt::registry& registry, entt::entity entity);
+		void OnCollider2DDestroy(entt::registry& registry, entt::entity entity);
+		void DispatchCollisionEvents();
 	protected:
 		UUID m_SceneID;
 		//entt::entity m_SceneEntity;
@@ -60,6 +142,46 @@ namespace RAPIER
 		uint32_t m_ViewportWidth = 0, m_ViewportHeight = 0;
 
 		b2World* m_PhysicsWorld = nullptr;
+		PhysicsSettings m_PhysicsSettings;
+		float m_PhysicsAccumulator = 0.0f;
+		float m_PhysicsAlpha = 1.0f;
+		JobCounter m_PhysicsJob;
+
+		//	Every non static body, packed so the step doesn't go through the registry. Holds the entity rather
+		//	than component pointers, the sprite group moves Transform pool entries without telling us. Rebuilt
+		//	whenever a body is created or destroyed. The physics job only writes the body state, the main thread
+		//	looks the components up and copies it in once the job is done.
+		struct PhysicsBody
+		{
+			b2Body* Body;
+			entt::entity Entity;
+
+			glm::vec2 PreviousPosition;
+			float PreviousAngle;
+			glm::vec2 Position;
+			float Angle;
+			bool Awake;
+
+			bool Settled;	//	Asleep and transform written at rest, nothing to do until it wakes
+		};
+		std::vector<PhysicsBody> m_PhysicsBodies;
+		bool m_PhysicsBodiesDirty = true;
+
+		std::vector<entt::entity> m_PendingPhysicsBodies;
+		bool m_PhysicsLoading = false;
+
+		//	Recorded by the contact listener during the step, dispatched to scripts in one batch after it
+		struct Collision2DEvent
+		{
+			entt::entity A;
+			entt::entity B;
+			UUID IDA;
+			UUID IDB;
+			bool Begin;
+			bool Trigger;
+		};
+		std::vector<Collision2DEvent> m_CollisionEvents;
+		ContactListener2D* m_ContactListener = nullptr;
 
 		std::string m_DebugName;
 
@@ -69,6 +191,7 @@ namespace RAPIER
 		friend class Entity;
 		friend class SceneSerializer;
 		friend class SceneHierarchyPanel;
+		friend class ContactListener2D;
 	};	//	END class Scene
 
 }	//	END namespace RAPIER
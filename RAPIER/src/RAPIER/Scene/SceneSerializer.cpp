@@ -1,6 +1,7 @@
 #include "rppch.h"
 #include "SceneSerializer.h"
 
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 #include "Entity.h"
 #include "Components.h"
 
@@ -270,6 +271,29 @@ namespace RAPIER
 
 			out << YAML::EndMap; // CircleRendererComponent
 		}
+		// --------------------------- PARTICLE EMITTER COMPONENT ----------------------- //
+		if (entity.HasComponent<ParticleEmitterComponent>())
+		{
+			out << YAML::Key << "ParticleEmitterComponent";
+			out << YAML::BeginMap; // ParticleEmitterComponent
+
+			auto& props = entity.GetComponent<ParticleEmitterComponent>().Props;
+			out << YAML::Key << "MaxParticles" << YAML::Value << props.MaxParticles;
+			out << YAML::Key << "EmissionRate" << YAML::Value << props.EmissionRate;
+			out << YAML::Key << "Emitting" << YAML::Value << props.Emitting;
+			out << YAML::Key << "LifeTime" << YAML::Value << props.LifeTime;
+			out << YAML::Key << "Velocity" << YAML::Value << props.Velocity;
+			out << YAML::Key << "VelocityVariation" << YAML::Value << props.VelocityVariation;
+			out << YAML::Key << "Acceleration" << YAML::Value << props.Acceleration;
+			out << YAML::Key << "RotationSpeed" << YAML::Value << props.RotationSpeed;
+			out << YAML::Key << "ColorBegin" << YAML::Value << props.ColorBegin;
+			out << YAML::Key << "ColorEnd" << YAML::Value << props.ColorEnd;
+			out << YAML::Key << "SizeBegin" << YAML::Value << props.SizeBegin;
+			out << YAML::Key << "SizeEnd" << YAML::Value << props.SizeEnd;
+			out << YAML::Key << "SizeVariation" << YAML::Value << props.SizeVariation;
+
+			out << YAML::EndMap; // ParticleEmitterComponent
+		}
 		// --------------------------- Rigidbody 2D COMPONENT ----------------------- //
 		if (entity.HasComponent<RigidBody2DComponent>())
 		{
@@ -295,6 +319,7 @@ namespace RAPIER
 			out << YAML::Key << "Friction"    << YAML::Value << bc2dComponent.Friction;
 			out << YAML::Key << "Restitution" << YAML::Value << bc2dComponent.Restitution;
 			out << YAML::Key << "RestitutionThreshold" << YAML::Value << bc2dComponent.RestitutionThreshold;
+			out << YAML::Key << "IsTrigger" << YAML::Value << bc2dComponent.IsTrigger;
 
 			out << YAML::EndMap; // BoxCollider2DComponent
 		}
@@ -311,6 +336,7 @@ namespace RAPIER
 			out << YAML::Key << "Friction" << YAML::Value << cc2dComponent.Friction;
 			out << YAML::Key << "Restitution" << YAML::Value << cc2dComponent.Restitution;
 			out << YAML::Key << "RestitutionThreshold" << YAML::Value << cc2dComponent.RestitutionThreshold;
+			out << YAML::Key << "IsTrigger" << YAML::Value << cc2dComponent.IsTrigger;
 
 			out << YAML::EndMap; // CircleCollider2DComponent
 		}
@@ -323,6 +349,7 @@ namespace RAPIER
 	void SceneSerializer::Serialize(const std::string& filepath)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Scene);
 
 		YAML::Emitter out;
 		out << YAML::BeginMap;
@@ -357,6 +384,7 @@ namespace RAPIER
 	bool SceneSerializer::Deserialize(const std::string& filepath)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Scene);
 
 		YAML::Node data;
 		try
@@ -452,6 +480,25 @@ namespace RAPIER
 					crc.Thickness = circleRendererComponent["Thickness"].as<float>();
 					crc.Fade = circleRendererComponent["Fade"].as<float>();
 				}
+				// --------------------------- PARTICLE EMITTER COMPONENT ----------------------- //
+				auto particleEmitterComponent = entity["ParticleEmitterComponent"];
+				if (particleEmitterComponent)
+				{
+					auto& props = deserializedEntity.AddComponent<ParticleEmitterComponent>().Props;
+					props.MaxParticles = particleEmitterComponent["MaxParticles"].as<uint32_t>();
+					props.EmissionRate = particleEmitterComponent["EmissionRate"].as<float>();
+					props.Emitting = particleEmitterComponent["Emitting"].as<bool>();
+					props.LifeTime = particleEmitterComponent["LifeTime"].as<float>();
+					props.Velocity = particleEmitterComponent["Velocity"].as<glm::vec2>();
+					props.VelocityVariation = particleEmitterComponent["VelocityVariation"].as<glm::vec2>();
+					props.Acceleration = particleEmitterComponent["Acceleration"].as<glm::vec2>();
+					props.RotationSpeed = particleEmitterComponent["RotationSpeed"].as<float>();
+					props.ColorBegin = particleEmitterComponent["ColorBegin"].as<glm::vec4>();
+					props.ColorEnd = particleEmitterComponent["ColorEnd"].as<glm::vec4>();
+					props.SizeBegin = particleEmitterComponent["SizeBegin"].as<float>();
+					props.SizeEnd = particleEmitterComponent["SizeEnd"].as<float>();
+					props.SizeVariation = particleEmitterComponent["SizeVariation"].as<float>();
+				}
 				// --------------------------- RIGIDBODY 2D COMPONENT ----------------------- //
 				auto rb2dComponent = entity["RigidBody2DComponent"];
 				if (rb2dComponent)
@@ -471,6 +518,8 @@ namespace RAPIER
 					bc2d.Friction    = bc2dComponent["Friction"].as<float>();
 					bc2d.Restitution = bc2dComponent["Restitution"].as<float>();
 					bc2d.RestitutionThreshold = bc2dComponent["RestitutionThreshold"].as<float>();
+					if (bc2dComponent["IsTrigger"])
+						bc2d.IsTrigger = bc2dComponent["IsTrigger"].as<bool>();
 				}
 				// --------------------------- CIRCLE COLLIDER 2D COMPONENT ----------------------- //
 				auto cc2dComponent = entity["CircleCollider2DComponent"];
@@ -483,6 +532,8 @@ namespace RAPIER
 					cc2d.Friction = cc2dComponent["Friction"].as<float>();
 					cc2d.Restitution = cc2dComponent["Restitution"].as<float>();
 					cc2d.RestitutionThreshold = cc2dComponent["RestitutionThreshold"].as<float>();
+					if (cc2dComponent["IsTrigger"])
+						cc2d.IsTrigger = cc2dComponent["IsTrigger"].as<bool>();
 				}
 			}
 		}
@@ -23,6 +23,13 @@ namespace RAPIER
 		virtual void OnCreate() {}
 		virtual void OnDestroy() {}
 		virtual void OnUpdate(Timestep ts) {}
+		virtual void OnPhysicsUpdate(float fixedTimeStep) {}
+
+		//	Called after the physics step, never from inside it. other is null if it was destroyed first.
+		virtual void OnCollisionBegin(Entity other) {}
+		virtual void OnCollisionEnd(Entity other) {}
+		virtual void OnTriggerBegin(Entity other) {}
+		virtual void OnTriggerEnd(Entity other) {}
 	private:
 		Entity m_Entity;
 		friend class Scene;
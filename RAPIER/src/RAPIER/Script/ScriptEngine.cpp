@@ -15,6 +15,7 @@
 
 #include "RAPIER/Scene/Scene.h"
 #include "RAPIER/Debug/Profiler.h"
+#include "RAPIER/Core/Memory/AllocationTracker.h"
 
 #include "imgui.h"
 
@@ -36,6 +37,15 @@ namespace RAPIER {
 	static MonoMethod* s_ExceptionMethod = nullptr;
 	static MonoClass* s_EntityClass = nullptr;
 
+	// Unmanaged thunks skip the argument boxing and checks of mono_runtime_invoke. The instance is passed
+	// as the first argument and an exception, if any, comes back through the last one.
+#ifdef RP_PLATFORM_WINDOWS
+	#define RP_MONO_THUNK_CALL __stdcall
+#else
+	#define RP_MONO_THUNK_CALL
+#endif
+	using UpdateThunk = void(RP_MONO_THUNK_CALL*)(MonoObject* instance, float ts, MonoException** exception);
+
 	struct EntityScriptClass
 	{
 		std::string FullName;
@@ -48,6 +58,8 @@ namespace RAPIER {
 		MonoMethod* OnDestroyMethod = nullptr;
 		MonoMethod* OnUpdateMethod = nullptr;
 		MonoMethod* OnPhysicsUpdateMethod = nullptr;
+		UpdateThunk OnUpdateThunk = nullptr;
+		UpdateThunk OnPhysicsUpdateThunk = nullptr;
 
 		// Physics
 		MonoMethod* OnCollisionBeginMethod = nullptr;
@@ -64,6 +76,8 @@ namespace RAPIER {
 			OnCreateMethod = GetMethod(image, FullName + ":OnCreate()");
 			OnUpdateMethod = GetMethod(image, FullName + ":OnUpdate(single)");
 			OnPhysicsUpdateMethod = GetMethod(image, FullName + ":OnPhysicsUpdate(single)");
+			OnUpdateThunk = OnUpdateMethod ? (UpdateThunk)mono_method_get_unmanaged_thunk(OnUpdateMethod) : nullptr;
+			OnPhysicsUpdateThunk = OnPhysicsUpdateMethod ? (UpdateThunk)mono_method_get_unmanaged_thunk(OnPhysicsUpdateMethod) : nullptr;
 
 			// Physics (Entity class)
 			OnCollisionBeginMethod = GetMethod(s_CoreAssemblyImage, "RAPIER.Entity:OnCollisionBegin(ulong)");
@@ -89,6 +103,37 @@ namespace RAPIER {
 
 	static std::unordered_map<std::string, EntityScriptClass> s_EntityClassMap;
 
+	// Dense copy of every instantiated entity that has an update method, so the per frame dispatch doesn't
+	// go through the nested entity instance maps. Rebuilt on the next update after anything changes.
+	struct ScriptUpdateEntry
+	{
+		UUID EntityID;
+		uint32_t Handle = 0;
+		UpdateThunk OnUpdate = nullptr;
+		UpdateThunk OnPhysicsUpdate = nullptr;
+	};
+
+	struct ScriptUpdateList
+	{
+		std::vector<ScriptUpdateEntry> Entries;
+		bool Dirty = true;
+	};
+
+	static std::unordered_map<UUID, ScriptUpdateList> s_ScriptUpdateLists;
+
+	static void InvalidateUpdateList(UUID sceneID)
+	{
+		// Only flag it, the list may be iterated right now if a script creates or destroys entities
+		if (auto it = s_ScriptUpdateLists.find(sceneID); it != s_ScriptUpdateLists.end())
+			it->second.Dirty = true;
+	}
+
+	static void InvalidateAllUpdateLists()
+	{
+		for (auto& [sceneID, updateList] : s_ScriptUpdateLists)
+			updateList.Dirty = true;
+	}
+
 	MonoAssembly* LoadAssemblyFromFile(const char* filepath)
 	{
 		if (filepath == NULL)
@@ -225,24 +270,75 @@ namespace RAPIER {
 		return string != nullptr ? std::string(mono_string_to_utf8(string)) : "";
 	}
 
+	static void HandleException(MonoObject* pException)
+	{
+		MonoClass* exceptionClass = mono_object_get_class(pException);
+		MonoType* exceptionType = mono_class_get_type(exceptionClass);
+		const char* typeName = mono_type_get_name(exceptionType);
+		std::string message = GetStringProperty("Message", exceptionClass, pException);
+		std::string stackTrace = GetStringProperty("StackTrace", exceptionClass, pException);
+
+		RP_CONSOLE_ERROR("{0}: {1}. Stack Trace: {2}", typeName, message, stackTrace);
+
+		void* args[] = { pException };
+		mono_runtime_invoke(s_ExceptionMethod, nullptr, args, nullptr);
+	}
+
 	static MonoObject* CallMethod(MonoObject* object, MonoMethod* method, void** params = nullptr)
 	{
 		MonoObject* pException = nullptr;
 		MonoObject* result = mono_runtime_invoke(method, object, params, &pException);
 		if (pException)
-		{
-			MonoClass* exceptionClass = mono_object_get_class(pException);
-			MonoType* exceptionType = mono_class_get_type(exceptionClass);
-			const char* typeName = mono_type_get_name(exceptionType);
-			std::string message = GetStringProperty("Message", exceptionClass, pException);
-			std::string stackTrace = GetStringProperty("StackTrace", exceptionClass, pException);
+			HandleException(pException);
+		return result;
+	}
 
-			RP_CONSOLE_ERROR("{0}: {1}. Stack Trace: {2}", typeName, message, stackTrace);
+	static void CallThunk(UpdateThunk thunk, MonoObject* object, float ts)
+	{
+		MonoException* pException = nullptr;
+		thunk(object, ts, &pException);
+		if (pException)
+			HandleException((MonoObject*)pException);
+	}
 
-			void* args[] = { pException };
-			MonoObject* result = mono_runtime_invoke(s_ExceptionMethod, nullptr, args, nullptr);
+	static const ScriptUpdateList& GetUpdateList(UUID sceneID)
+	{
+		ScriptUpdateList& updateList = s_ScriptUpdateLists[sceneID];
+		if (!updateList.Dirty)
+			return updateList;
+
+		RP_PROFILE_FUNC();
+		updateList.Entries.clear();
+		updateList.Dirty = false;
+
+		auto entityInstanceMap = s_EntityInstanceMap.find(sceneID);
+		if (entityInstanceMap == s_EntityInstanceMap.end())
+			return updateList;
+
+		for (auto& [entityID, entityInstanceData] : entityInstanceMap->second)
+		{
+			const EntityInstance& entityInstance = entityInstanceData.Instance;
+			if (!entityInstance.ScriptClass || !entityInstance.IsRuntimeAvailable())
+				continue;
+
+			const EntityScriptClass& scriptClass = *entityInstance.ScriptClass;
+			if (scriptClass.OnUpdateThunk || scriptClass.OnPhysicsUpdateThunk)
+				updateList.Entries.push_back({ entityID, entityInstance.Handle, scriptClass.OnUpdateThunk, scriptClass.OnPhysicsUpdateThunk });
 		}
-		return result;
+
+		return updateList;
+	}
+
+	// Once a script has created or destroyed entities mid-update the cached entries may be stale. A freed
+	// gchandle can be handed out again for another object, so the entry must still be its entity's instance.
+	static bool IsUpdateEntryCurrent(UUID sceneID, const ScriptUpdateEntry& entry)
+	{
+		auto entityInstanceMap = s_EntityInstanceMap.find(sceneID);
+		if (entityInstanceMap == s_EntityInstanceMap.end())
+			return false;
+
+		auto entityInstanceData = entityInstanceMap->second.find(entry.EntityID);
+		return entityInstanceData != entityInstanceMap->second.end() && entityInstanceData->second.Instance.Handle == entry.Handle;
 	}
 
 	static void PrintClassMethods(MonoClass* monoClass)
@@ -311,6 +407,7 @@ namespace RAPIER {
 		s_CoreAssemblyImage = GetAssemblyImage(s_CoreAssembly);
 
 		s_ExceptionMethod = GetMethod(s_CoreAssemblyImage, "RAPIER.RuntimeException:OnException(object)");
+		InvalidateAllUpdateLists();
 		s_EntityClass = mono_class_from_name(s_CoreAssemblyImage, "RAPIER", "Entity");
 
 		return true;
@@ -380,6 +477,8 @@ namespace RAPIER {
 
 	void ScriptEngine::Init(const std::string& assemblyPath)
 	{
+		RP_MEMORY_TAG(Script);
+
 		InitMono();
 		LoadRapierRuntimeAssembly(assemblyPath);
 	}
@@ -389,6 +488,7 @@ namespace RAPIER {
 		ShutdownMono();
 		s_SceneContext = nullptr;
 		s_EntityInstanceMap.clear();
+		s_ScriptUpdateLists.clear();
 	}
 
 	void ScriptEngine::OnSceneDestruct(UUID sceneID)
@@ -398,6 +498,7 @@ namespace RAPIER {
 			s_EntityInstanceMap.at(sceneID).clear();
 			s_EntityInstanceMap.erase(sceneID);
 		}
+		InvalidateUpdateList(sceneID);
 	}
 
 	static std::unordered_map<std::string, MonoClass*> s_Classes;
@@ -405,7 +506,10 @@ namespace RAPIER {
 	{
 		s_Classes.clear();
 		if (!scene)
+		{
 			s_EntityInstanceMap.clear();
+			InvalidateAllUpdateLists();
+		}
 		s_SceneContext = scene;
 	}
 
@@ -441,6 +545,7 @@ namespace RAPIER {
 	void ScriptEngine::OnCreateEntity(Entity entity)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Script);
 
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
 		if (entityInstance.ScriptClass->OnCreateMethod)
@@ -450,45 +555,75 @@ namespace RAPIER {
 	void ScriptEngine::OnUpdateEntity(Entity entity, Timestep ts)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Script);
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
-		entityInstance.ScriptClass->FullName.c_str();
-		if (entityInstance.ScriptClass->OnUpdateMethod)
-		{
-			void* args[] = { &ts };
-			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnUpdateMethod, args);
-		}
+		if (entityInstance.ScriptClass->OnUpdateThunk)
+			CallThunk(entityInstance.ScriptClass->OnUpdateThunk, entityInstance.GetInstance(), ts);
 	}
 
 	void ScriptEngine::OnPhysicsUpdateEntity(Entity entity, float fixedTimeStep)
 	{
 		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Script);
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
-		if (entityInstance.ScriptClass->OnPhysicsUpdateMethod)
+		if (entityInstance.ScriptClass->OnPhysicsUpdateThunk)
+			CallThunk(entityInstance.ScriptClass->OnPhysicsUpdateThunk, entityInstance.GetInstance(), fixedTimeStep);
+	}
+
+	void ScriptEngine::OnUpdateEntities(UUID sceneID, Timestep ts)
+	{
+		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Script);
+
+		const ScriptUpdateList& updateList = GetUpdateList(sceneID);
+		for (const ScriptUpdateEntry& entry : updateList.Entries)
 		{
-			void* args[] = { &fixedTimeStep };
-			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnPhysicsUpdateMethod, args);
+			if (updateList.Dirty && !IsUpdateEntryCurrent(sceneID, entry))
+				continue;
+
+			// Null if the instance was destroyed earlier this frame
+			MonoObject* instance = mono_gchandle_get_target(entry.Handle);
+			if (entry.OnUpdate && instance)
+				CallThunk(entry.OnUpdate, instance, ts);
 		}
 	}
 
-	void ScriptEngine::OnCollision2DBegin(Entity entity, Entity other)
+	void ScriptEngine::OnPhysicsUpdateEntities(UUID sceneID, float fixedTimeStep)
+	{
+		RP_PROFILE_FUNC();
+		RP_MEMORY_TAG(Script);
+
+		const ScriptUpdateList& updateList = GetUpdateList(sceneID);
+		for (const ScriptUpdateEntry& entry : updateList.Entries)
+		{
+			if (updateList.Dirty && !IsUpdateEntryCurrent(sceneID, entry))
+				continue;
+
+			MonoObject* instance = mono_gchandle_get_target(entry.Handle);
+			if (entry.OnPhysicsUpdate && instance)
+				CallThunk(entry.OnPhysicsUpdate, instance, fixedTimeStep);
+		}
+	}
+
+	void ScriptEngine::OnCollision2DBegin(Entity entity, UUID otherID)
 	{
 		RP_PROFILE_FUNC();
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
 		if (entityInstance.ScriptClass->OnCollision2DBeginMethod)
 		{
-			UUID id = other.GetUUID();
+			UUID id = otherID;
 			void* args[] = { &id };
 			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnCollision2DBeginMethod, args);
 		}
 	}
 
-	void ScriptEngine::OnCollision2DEnd(Entity entity, Entity other)
+	void ScriptEngine::OnCollision2DEnd(Entity entity, UUID otherID)
 	{
 		RP_PROFILE_FUNC();
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
 		if (entityInstance.ScriptClass->OnCollision2DEndMethod)
 		{
-			UUID id = other.GetUUID();
+			UUID id = otherID;
 			void* args[] = { &id };
 			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnCollision2DEndMethod, args);
 		}
@@ -518,25 +653,25 @@ namespace RAPIER {
 		}
 	}
 
-	void ScriptEngine::OnTriggerBegin(Entity entity, Entity other)
+	void ScriptEngine::OnTriggerBegin(Entity entity, UUID otherID)
 	{
 		RP_PROFILE_FUNC();
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
 		if (entityInstance.ScriptClass->OnTriggerBeginMethod)
 		{
-			UUID id = other.GetUUID();
+			UUID id = otherID;
 			void* args[] = { &id };
 			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnTriggerBeginMethod, args);
 		}
 	}
 
-	void ScriptEngine::OnTriggerEnd(Entity entity, Entity other)
+	void ScriptEngine::OnTriggerEnd(Entity entity, UUID otherID)
 	{
 		RP_PROFILE_FUNC();
 		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
 		if (entityInstance.ScriptClass->OnTriggerEndMethod)
 		{
-			UUID id = other.GetUUID();
+			UUID id = otherID;
 			void* args[] = { &id };
 			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnTriggerEndMethod, args);
 		}
@@ -617,6 +752,16 @@ namespace RAPIER {
 		return entity.HasComponent<ScriptComponent>() && ModuleExists(entity.GetComponent<ScriptComponent>().ModuleName);
 	}
 
+	bool ScriptEngine::IsEntityInstantiated(Entity entity)
+	{
+		auto entityInstanceMap = s_EntityInstanceMap.find(entity.GetSceneUUID());
+		if (entityInstanceMap == s_EntityInstanceMap.end())
+			return false;
+
+		auto entityInstanceData = entityInstanceMap->second.find(entity.GetUUID());
+		return entityInstanceData != entityInstanceMap->second.end() && entityInstanceData->second.Instance.IsRuntimeAvailable();
+	}
+
 	void ScriptEngine::OnScriptComponentDestroyed(UUID sceneID, UUID entityID)
 	{
 		if (s_EntityInstanceMap.find(sceneID) != s_EntityInstanceMap.end())
@@ -626,6 +771,7 @@ namespace RAPIER {
 			if (entityMap.find(entityID) != entityMap.end())
 				entityMap.erase(entityID);
 		}
+		InvalidateUpdateList(sceneID);
 	}
 
 	bool ScriptEngine::ModuleExists(const std::string& moduleName)
@@ -852,6 +998,8 @@ namespace RAPIER {
 		}
 
 		Destroy(entityInstance.Handle);
+		entityInstance.Handle = 0;
+		InvalidateUpdateList(scene->GetUUID());
 	}
 
 	void ScriptEngine::ShutdownScriptEntity(Entity entity, const std::string& moduleName)
@@ -889,6 +1037,7 @@ namespace RAPIER {
 
 		void* param[] = { &id };
 		CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->Constructor, param);
+		InvalidateUpdateList(scene->GetUUID());
 
 		// Set all public fields to appropriate values
 		ScriptModuleFieldMap& moduleFieldMap = scriptComponent.ModuleFieldMap;
@@ -57,19 +57,24 @@ namespace RAPIER
 		static void OnCreateEntity(Entity entity);
 		static void OnUpdateEntity(Entity entity, Timestep ts);
 		static void OnPhysicsUpdateEntity(Entity entity, float fixedTimeStep);
+		// Update every instantiated script entity of a scene, once per frame / physics step
+		static void OnUpdateEntities(UUID sceneID, Timestep ts);
+		static void OnPhysicsUpdateEntities(UUID sceneID, float fixedTimeStep);
 
-		static void OnCollision2DBegin(Entity entity, Entity other);
-		static void OnCollision2DEnd(Entity entity, Entity other);
+		static void OnCollision2DBegin(Entity entity, UUID otherID);
+		static void OnCollision2DEnd(Entity entity, UUID otherID);
 		static void OnCollisionBegin(Entity entity, Entity other);
 		static void OnCollisionEnd(Entity entity, Entity other);
-		static void OnTriggerBegin(Entity entity, Entity other);
-		static void OnTriggerEnd(Entity entity, Entity other);
+		static void OnTriggerBegin(Entity entity, UUID otherID);
+		static void OnTriggerEnd(Entity entity, UUID otherID);
 		static void OnJointBreak(Entity entity, const glm::vec3& linearForce, const glm::vec3& angularForce);
 
 		static MonoObject* Construct(const std::string& fullName, bool callConstructor = true, void** parameters = nullptr);
 		static MonoClass* GetCoreClass(const std::string& fullName);
 
 		static bool IsEntityModuleValid(Entity entity);
+		//	Has a live script instance, cheap enough to check per event
+		static bool IsEntityInstantiated(Entity entity);
 
 		static void OnScriptComponentDestroyed(UUID sceneID, UUID entityID);
 
@@ -49,6 +49,16 @@ namespace RAPIER
 
 		//  -----------------------------  SCENE  -----------------------------  //
 		mono_add_internal_call("RAPIER.Scene::GetEntities", RAPIER::Script::RAPIER_Scene_GetEntities);
+		mono_add_internal_call("RAPIER.Scene::GetEntityIDs_Native", RAPIER::Script::RAPIER_Scene_GetEntityIDs);
+		mono_add_internal_call("RAPIER.Scene::GetTransforms_Native", RAPIER::Script::RAPIER_Scene_GetTransforms);
+		mono_add_internal_call("RAPIER.Scene::SetTransforms_Native", RAPIER::Script::RAPIER_Scene_SetTransforms);
+		mono_add_internal_call("RAPIER.Scene::GetRigidBody2DVelocities_Native", RAPIER::Script::RAPIER_Scene_GetRigidBody2DVelocities);
+		mono_add_internal_call("RAPIER.Scene::SetRigidBody2DVelocities_Native", RAPIER::Script::RAPIER_Scene_SetRigidBody2DVelocities);
+
+		//  -----------------------------  PHYSICS 2D  -----------------------------  //
+		mono_add_internal_call("RAPIER.Physics2D::Raycast_Native", RAPIER::Script::RAPIER_Physics2D_Raycast);
+		mono_add_internal_call("RAPIER.Physics2D::CircleCast_Native", RAPIER::Script::RAPIER_Physics2D_CircleCast);
+		mono_add_internal_call("RAPIER.Physics2D::OverlapAABB_Native", RAPIER::Script::RAPIER_Physics2D_OverlapAABB);
 
 		//  -----------------------------  INPUT  -----------------------------  //
 		mono_add_internal_call("RAPIER.Input::IsKeyPressed_Native", RAPIER::Script::RAPIER_Input_IsKeyPressed);
@@ -42,24 +42,225 @@ namespace RAPIER::Script
 	//  -----------------------------  SCENE  -----------------------------  //
 	MonoArray* RAPIER_Scene_GetEntities()
 	{
+		RP_PROFILE_FUNC();
+
 		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
 		RP_CORE_ASSERT(scene, "No active scene!");
 		const auto& entityMap = scene->GetEntityMap();
 
-		MonoArray* result = mono_array_new(mono_domain_get(), ScriptEngine::GetCoreClass("RAPIER.Entity"), entityMap.size());
+		//	Resolve the constructor once rather than parsing a method description for every entity
+		MonoClass* entityClass = ScriptEngine::GetCoreClass("RAPIER.Entity");
+		MonoMethod* constructor = mono_class_get_method_from_name(entityClass, ".ctor", 1);
+		MonoArray* result = mono_array_new(mono_domain_get(), entityClass, entityMap.size());
 
 		uint32_t index = 0;
 		for (auto& [id, entity] : entityMap)
 		{
 			UUID uuid = id;
 			void* data[] = { &uuid };
-			MonoObject* obj = ScriptEngine::Construct("RAPIER.Entity:.ctor(ulong)", true, data);
+			MonoObject* obj = mono_object_new(mono_domain_get(), entityClass);
+			mono_runtime_invoke(constructor, obj, data, nullptr);
 			mono_array_set(result, MonoObject*, index++, obj);
 		}
 
 		return result;
 	}
 
+	template<typename T>
+	static T* GetArrayData(MonoArray* array, uint32_t& outLength)
+	{
+		outLength = array ? (uint32_t)mono_array_length(array) : 0;
+		return outLength ? mono_array_addr(array, T, 0) : nullptr;
+	}
+
+	//	Copies every entity with Component into the arrays, readFunc converts the component into Data
+	template<typename Component, typename Data, typename ReadFunc>
+	static int32_t ReadBulk(MonoArray* outIDs, MonoArray* outData, ReadFunc readFunc)
+	{
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t idCapacity, dataCapacity;
+		uint64_t* ids = GetArrayData<uint64_t>(outIDs, idCapacity);
+		Data* data = GetArrayData<Data>(outData, dataCapacity);
+		const uint32_t capacity = std::min(idCapacity, dataCapacity);
+
+		int32_t count = 0;
+		auto view = scene->GetAllEntitiesWith<IDComponent, Component>();
+		for (auto entity : view)
+		{
+			if ((uint32_t)count < capacity)
+			{
+				auto [idComponent, component] = view.template get<IDComponent, Component>(entity);
+				ids[count] = idComponent.ID;
+				readFunc(component, data[count]);
+			}
+			count++;
+		}
+
+		return count;
+	}
+
+	//	The IDs are usually unchanged from ReadBulk, so walk the same view and only fall back to the entity
+	//	map from the first entity that doesn't line up
+	template<typename Component, typename Data, typename WriteFunc>
+	static void WriteBulk(MonoArray* inIDs, MonoArray* inData, int32_t count, WriteFunc writeFunc)
+	{
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t idLength, dataLength;
+		const uint64_t* ids = GetArrayData<uint64_t>(inIDs, idLength);
+		const Data* data = GetArrayData<Data>(inData, dataLength);
+		const uint32_t total = std::min({ (uint32_t)std::max(count, 0), idLength, dataLength });
+
+		uint32_t index = 0;
+		auto view = scene->GetAllEntitiesWith<IDComponent, Component>();
+		for (auto entity : view)
+		{
+			if (index == total)
+				break;
+
+			auto [idComponent, component] = view.template get<IDComponent, Component>(entity);
+			if ((uint64_t)idComponent.ID != ids[index])
+				break;
+
+			writeFunc(component, data[index++]);
+		}
+
+		const auto& entityMap = scene->GetEntityMap();
+		for (; index < total; index++)
+		{
+			auto it = entityMap.find(ids[index]);
+			if (it == entityMap.end())
+				continue;
+
+			Entity entity = it->second;
+			if (entity.HasComponent<Component>())
+				writeFunc(entity.GetComponent<Component>(), data[index]);
+		}
+	}
+
+	int32_t RAPIER_Scene_GetEntityIDs(MonoArray* outIDs)
+	{
+		RP_PROFILE_FUNC();
+
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t capacity;
+		uint64_t* ids = GetArrayData<uint64_t>(outIDs, capacity);
+
+		int32_t count = 0;
+		auto view = scene->GetAllEntitiesWith<IDComponent>();
+		for (auto entity : view)
+		{
+			if ((uint32_t)count < capacity)
+				ids[count] = view.get<IDComponent>(entity).ID;
+			count++;
+		}
+
+		return count;
+	}
+
+	static_assert(sizeof(TransformComponent) == sizeof(glm::vec3) * 3, "RAPIER.Transform must match TransformComponent");
+
+	int32_t RAPIER_Scene_GetTransforms(MonoArray* outIDs, MonoArray* outTransforms)
+	{
+		RP_PROFILE_FUNC();
+		return ReadBulk<TransformComponent, TransformComponent>(outIDs, outTransforms, [](const TransformComponent& transform, TransformComponent& out)
+		{
+			out = transform;
+		});
+	}
+
+	void RAPIER_Scene_SetTransforms(MonoArray* inIDs, MonoArray* inTransforms, int32_t count)
+	{
+		RP_PROFILE_FUNC();
+		WriteBulk<TransformComponent, TransformComponent>(inIDs, inTransforms, count, [](TransformComponent& transform, const TransformComponent& in)
+		{
+			transform = in;
+		});
+	}
+
+	int32_t RAPIER_Scene_GetRigidBody2DVelocities(MonoArray* outIDs, MonoArray* outVelocities)
+	{
+		RP_PROFILE_FUNC();
+		return ReadBulk<RigidBody2DComponent, RigidBody2DVelocity>(outIDs, outVelocities, [](const RigidBody2DComponent& rb2d, RigidBody2DVelocity& out)
+		{
+			//	No body outside of runtime
+			const b2Body* body = (const b2Body*)rb2d.RuntimeBody;
+			const b2Vec2 linear = body ? body->GetLinearVelocity() : b2Vec2(0.0f, 0.0f);
+			out.Linear = { linear.x, linear.y };
+			out.Angular = body ? body->GetAngularVelocity() : 0.0f;
+		});
+	}
+
+	void RAPIER_Scene_SetRigidBody2DVelocities(MonoArray* inIDs, MonoArray* inVelocities, int32_t count)
+	{
+		RP_PROFILE_FUNC();
+		WriteBulk<RigidBody2DComponent, RigidBody2DVelocity>(inIDs, inVelocities, count, [](RigidBody2DComponent& rb2d, const RigidBody2DVelocity& in)
+		{
+			b2Body* body = (b2Body*)rb2d.RuntimeBody;
+			if (!body)
+				return;
+
+			body->SetLinearVelocity({ in.Linear.x, in.Linear.y });
+			body->SetAngularVelocity(in.Angular);
+		});
+	}
+
+	//  -----------------------------  PHYSICS 2D  -----------------------------  //
+	static_assert(sizeof(PhysicsRay2D) == 20, "RAPIER.Ray2D must match PhysicsRay2D");
+	static_assert(sizeof(PhysicsCircleCast2D) == 24, "RAPIER.CircleCast2D must match PhysicsCircleCast2D");
+	static_assert(sizeof(PhysicsAABB2D) == 16, "RAPIER.AABB2D must match PhysicsAABB2D");
+	static_assert(sizeof(PhysicsHit2D) == 32, "RAPIER.Hit2D must match PhysicsHit2D");
+
+	void RAPIER_Physics2D_Raycast(MonoArray* inRays, MonoArray* outHits, int32_t count)
+	{
+		RP_PROFILE_FUNC();
+
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t rayLength, hitLength;
+		const PhysicsRay2D* rays = GetArrayData<PhysicsRay2D>(inRays, rayLength);
+		PhysicsHit2D* hits = GetArrayData<PhysicsHit2D>(outHits, hitLength);
+		scene->Raycast2D(rays, std::min({ (uint32_t)std::max(count, 0), rayLength, hitLength }), hits);
+	}
+
+	void RAPIER_Physics2D_CircleCast(MonoArray* inCasts, MonoArray* outHits, int32_t count)
+	{
+		RP_PROFILE_FUNC();
+
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t castLength, hitLength;
+		const PhysicsCircleCast2D* casts = GetArrayData<PhysicsCircleCast2D>(inCasts, castLength);
+		PhysicsHit2D* hits = GetArrayData<PhysicsHit2D>(outHits, hitLength);
+		scene->CircleCast2D(casts, std::min({ (uint32_t)std::max(count, 0), castLength, hitLength }), hits);
+	}
+
+	void RAPIER_Physics2D_OverlapAABB(MonoArray* inBoxes, int32_t count, int32_t maxResultsPerBox, MonoArray* outIDs, MonoArray* outCounts)
+	{
+		RP_PROFILE_FUNC();
+
+		Ref<Scene> scene = ScriptEngine::GetCurrentSceneContext();
+		RP_CORE_ASSERT(scene, "No active scene!");
+
+		uint32_t boxLength, idLength, countLength;
+		const PhysicsAABB2D* boxes = GetArrayData<PhysicsAABB2D>(inBoxes, boxLength);
+		uint64_t* ids = GetArrayData<uint64_t>(outIDs, idLength);
+		uint32_t* counts = GetArrayData<uint32_t>(outCounts, countLength);
+
+		const uint32_t maxResults = (uint32_t)std::max(maxResultsPerBox, 0);
+		uint32_t total = std::min({ (uint32_t)std::max(count, 0), boxLength, countLength });
+		if (maxResults > 0)
+			total = std::min(total, idLength / maxResults);
+		scene->OverlapAABB2D(boxes, total, maxResults, ids, counts);
+	}
+
 	
 	//  -----------------------------  INPUT  -----------------------------  //
 	bool RAPIER_Input_IsKeyPressed(KeyCode key)
@@ -16,6 +16,27 @@ namespace RAPIER::Script
 	//  -----------------------------  SCENE  -----------------------------  //
 	MonoArray* RAPIER_Scene_GetEntities();
 
+	//	Bulk access, copies straight between the registry and caller owned managed arrays so iterating
+	//	thousands of entities doesn't allocate. Getters return the total count, which may be larger than
+	//	the arrays passed in. Setters take the IDs the getter returned, in the same order when possible.
+	struct RigidBody2DVelocity
+	{
+		glm::vec2 Linear;
+		float Angular;
+	};
+
+	int32_t RAPIER_Scene_GetEntityIDs(MonoArray* outIDs);
+	int32_t RAPIER_Scene_GetTransforms(MonoArray* outIDs, MonoArray* outTransforms);
+	void RAPIER_Scene_SetTransforms(MonoArray* inIDs, MonoArray* inTransforms, int32_t count);
+	int32_t RAPIER_Scene_GetRigidBody2DVelocities(MonoArray* outIDs, MonoArray* outVelocities);
+	void RAPIER_Scene_SetRigidBody2DVelocities(MonoArray* inIDs, MonoArray* inVelocities, int32_t count);
+
+	//  -----------------------------  PHYSICS 2D  -----------------------------  //
+	//	One transition per batch, count is clamped to the array lengths
+	void RAPIER_Physics2D_Raycast(MonoArray* inRays, MonoArray* outHits, int32_t count);
+	void RAPIER_Physics2D_CircleCast(MonoArray* inCasts, MonoArray* outHits, int32_t count);
+	void RAPIER_Physics2D_OverlapAABB(MonoArray* inBoxes, int32_t count, int32_t maxResultsPerBox, MonoArray* outIDs, MonoArray* outCounts);
+
 	//  -----------------------------  INPUT  -----------------------------  //
 	bool RAPIER_Input_IsKeyPressed(KeyCode key);
 	bool RAPIER_Input_IsMouseButtonPressed(MouseCode button);